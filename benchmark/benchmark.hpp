@@ -0,0 +1,242 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_BENCHMARK_HPP
+#define FCAROUGE_BENCHMARK_HPP
+
+//! @file
+//! @brief Benchmark measurement support.
+//!
+//! @details Measures the filter operations with optional hardware performance
+//! monitoring unit (PMU) counters collected through the Linux
+//! `perf_event_open` system call. The counters are reported next to the
+//! timings, per iteration, to support comparing the instructions per cycle
+//! (IPC) and cache miss rates of the filter sizes and backends.
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <string>
+#include <string_view>
+
+#ifdef FCAROUGE_BENCHMARK_PERF_COUNTERS
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace fcarouge::benchmark {
+//! @brief Hardware performance counters of the calling thread.
+//!
+//! @details The counters are opened as one group to be scheduled together on
+//! the PMU. Counters unsupported by the processor, or denied by the
+//! `perf_event_paranoid` setting, are omitted. Only the user space activity is
+//! counted. The counters are a no-op unless the benchmarks are configured with
+//! the `KALMAN_BENCHMARK_PERF_COUNTERS` option.
+class performance_counters {
+public:
+#ifdef FCAROUGE_BENCHMARK_PERF_COUNTERS
+  performance_counters() {
+    for (const auto &[name, type, config] : events) {
+      perf_event_attr attribute{};
+      attribute.type = type;
+      attribute.size = sizeof(perf_event_attr);
+      attribute.config = config;
+      attribute.disabled = leader < 0;
+      attribute.exclude_kernel = 1;
+      attribute.exclude_hv = 1;
+      attribute.read_format = PERF_FORMAT_GROUP;
+
+      const auto descriptor{static_cast<int>(
+          syscall(SYS_perf_event_open, &attribute, 0, -1, leader, 0))};
+
+      if (descriptor < 0) {
+        continue;
+      }
+
+      if (leader < 0) {
+        leader = descriptor;
+      }
+
+      descriptors[count] = descriptor;
+      names[count] = name;
+      ++count;
+    }
+  }
+
+  performance_counters(const performance_counters &other) = delete;
+  performance_counters(performance_counters &&other) noexcept = delete;
+  auto operator=(const performance_counters &other)
+      -> performance_counters & = delete;
+  auto operator=(performance_counters &&other) noexcept
+      -> performance_counters & = delete;
+
+  ~performance_counters() {
+    for (std::size_t index{0}; index < count; ++index) {
+      close(descriptors[index]);
+    }
+  }
+
+  void start() const {
+    if (leader >= 0) {
+      ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+      ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+  }
+
+  void stop() const {
+    if (leader >= 0) {
+      ioctl(leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    }
+  }
+
+  //! @brief Reports the counters per iteration and their derived rates.
+  void report(::benchmark::State &state) const {
+    if (leader < 0) {
+      state.SetLabel("performance counters unavailable");
+      return;
+    }
+
+    // The group read format is the number of counters followed by the values
+    // in the order the counters were opened.
+    std::array<std::uint64_t, events.size() + 1> values{};
+    if (read(leader, values.data(), sizeof(values)) < 0) {
+      state.SetLabel("performance counters unreadable");
+      return;
+    }
+
+    std::array<double, events.size()> totals{};
+    for (std::size_t index{0}; index < count; ++index) {
+      totals[index] = static_cast<double>(values[index + 1]);
+      state.counters[std::string{names[index]}] = ::benchmark::Counter(
+          totals[index], ::benchmark::Counter::kAvgIterations);
+    }
+
+    const auto total{[this, &totals](std::string_view name) {
+      for (std::size_t index{0}; index < count; ++index) {
+        if (names[index] == name) {
+          return totals[index];
+        }
+      }
+      return 0.;
+    }};
+
+    if (const double cycles{total("cycles")}; cycles > 0.) {
+      state.counters["ipc"] = total("instructions") / cycles;
+    }
+
+    if (const double instructions{total("instructions")}; instructions > 0.) {
+      state.counters["l1d_mpki"] = 1000. * total("l1d_misses") / instructions;
+      state.counters["llc_mpki"] = 1000. * total("llc_misses") / instructions;
+      state.counters["branch_mpki"] =
+          1000. * total("branch_misses") / instructions;
+    }
+  }
+
+private:
+  struct event {
+    std::string_view name;
+    std::uint32_t type;
+    std::uint64_t config;
+  };
+
+  //! @brief The counted events.
+  //!
+  //! @details The vector instructions count is a raw, processor specific,
+  //! event. The default configuration is the Intel
+  //! `FP_ARITH_INST_RETIRED` packed single and double precision floating-point
+  //! instructions of all widths.
+  static constexpr std::array events{
+      event{"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+      event{"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+      event{"l1d_misses", PERF_TYPE_HW_CACHE,
+            std::uint64_t{PERF_COUNT_HW_CACHE_L1D} |
+                (std::uint64_t{PERF_COUNT_HW_CACHE_OP_READ} << 8U) |
+                (std::uint64_t{PERF_COUNT_HW_CACHE_RESULT_MISS} << 16U)},
+      event{"llc_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+      event{"branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+      event{"vector_instructions", PERF_TYPE_RAW,
+            FCAROUGE_BENCHMARK_VECTOR_EVENT}};
+
+  int leader{-1};
+  std::size_t count{0};
+  std::array<int, events.size()> descriptors{};
+  std::array<std::string_view, events.size()> names{};
+#else
+  constexpr void start() const {}
+
+  constexpr void stop() const {}
+
+  constexpr void report([[maybe_unused]] ::benchmark::State &state) const {}
+#endif
+};
+
+//! @brief Measures the callable under benchmark.
+//!
+//! @details The performance counters, when enabled, are collected over the
+//! entire benchmark loop and reported as averages per iteration.
+template <typename Callable>
+void measure(::benchmark::State &state, Callable callable) {
+  const performance_counters counters;
+
+  counters.start();
+  for (auto _ : state) {
+    callable();
+    ::benchmark::ClobberMemory();
+  }
+  counters.stop();
+  counters.report(state);
+}
+
+//! @brief The formatted name of the benchmark.
+//!
+//! @details The name is composed of the backend, operation, and the `state x
+//! output x input` filter dimensions.
+[[nodiscard]] inline auto name(std::string_view operation,
+                               std::size_t state_size, std::size_t output_size,
+                               std::size_t input_size) -> std::string {
+  return std::format("{}_{}_{}x{}x{}", FCAROUGE_BENCHMARK_BACKEND, operation,
+                     state_size, output_size, input_size);
+}
+} // namespace fcarouge::benchmark
+
+#endif // FCAROUGE_BENCHMARK_HPP
@@ -0,0 +1,156 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+// The compile-time benchmark translation unit. The filter dimensions, kind, and
+// included headers are configured by the build definitions of each measured
+// object such that its compile time and size reflect a single deduced filter.
+
+#define FCAROUGE_BENCHMARK_SCALAR                                              \
+  (FCAROUGE_BENCHMARK_STATE == 1 && FCAROUGE_BENCHMARK_OUTPUT == 1 &&          \
+   !FCAROUGE_BENCHMARK_EXTENDED)
+
+#if FCAROUGE_BENCHMARK_CORE
+#include "fcarouge/kalman_core.hpp"
+#if FCAROUGE_BENCHMARK_EXTENDED
+#include "fcarouge/kalman_internal/x_z_p_q_r_hh_f_us_ps.hpp"
+#elif FCAROUGE_BENCHMARK_SCALAR && FCAROUGE_BENCHMARK_INPUT == 0
+#include "fcarouge/kalman_internal/x_z_p_q_r.hpp"
+#elif FCAROUGE_BENCHMARK_SCALAR
+#include "fcarouge/kalman_internal/x_z_u_p_q_r.hpp"
+#elif FCAROUGE_BENCHMARK_INPUT == 0
+#include "fcarouge/kalman_internal/x_z_p_q_r_h_f.hpp"
+#else
+#include "fcarouge/kalman_internal/x_z_u_p_q_r_h_f_g_us_ps.hpp"
+#endif
+#else
+#include "fcarouge/kalman.hpp"
+#endif
+#if !FCAROUGE_BENCHMARK_SCALAR
+#include "fcarouge/linalg.hpp"
+#endif
+
+#include <cstddef>
+
+namespace fcarouge::benchmark {
+#if !FCAROUGE_BENCHMARK_SCALAR
+template <auto Size> using vector = column_vector<float, Size>;
+template <auto Row, auto Column> using matrix = matrix<float, Row, Column>;
+inline constexpr std::size_t state_size{FCAROUGE_BENCHMARK_STATE};
+inline constexpr std::size_t output_size{FCAROUGE_BENCHMARK_OUTPUT};
+inline constexpr std::size_t input_size{FCAROUGE_BENCHMARK_INPUT};
+#endif
+
+#if FCAROUGE_BENCHMARK_EXTENDED
+//! @brief Instantiates the extended filter declaration, prediction, and update.
+void compile(const vector<output_size> &z) {
+  using jacobian = matrix<output_size, state_size>;
+
+  kalman filter{
+      state{kalman_internal::zero<vector<state_size>>},
+      output<vector<output_size>>,
+      estimate_uncertainty{kalman_internal::one<matrix<state_size, state_size>>},
+      process_uncertainty{kalman_internal::one<matrix<state_size, state_size>>},
+      output_uncertainty{
+          kalman_internal::one<matrix<output_size, output_size>>},
+      output_model{[]([[maybe_unused]] const vector<state_size> &x) {
+        return jacobian{kalman_internal::one<jacobian>};
+      }},
+      transition{[](const vector<state_size> &x) { return x; }},
+      observation{[](const vector<state_size> &x) -> vector<output_size> {
+        return kalman_internal::one<jacobian> * x;
+      }},
+      update_types<>,
+      prediction_types<>};
+
+  filter.predict();
+  filter.update(z);
+}
+#elif FCAROUGE_BENCHMARK_SCALAR && FCAROUGE_BENCHMARK_INPUT == 0
+//! @brief Instantiates the scalar filter declaration, prediction, and update.
+void compile(float z) {
+  kalman filter{state{0.F}, output<float>, estimate_uncertainty{1.F},
+                process_uncertainty{0.1F}, output_uncertainty{0.1F}};
+
+  filter.predict();
+  filter.update(z);
+}
+#elif FCAROUGE_BENCHMARK_SCALAR
+//! @brief Instantiates the scalar control filter declaration, prediction, and
+//! update.
+void compile(float z, float u) {
+  kalman filter{state{0.F},
+                output<float>,
+                input<float>,
+                estimate_uncertainty{1.F},
+                process_uncertainty{0.1F},
+                output_uncertainty{0.1F}};
+
+  filter.predict(u);
+  filter.update(z);
+}
+#elif FCAROUGE_BENCHMARK_INPUT == 0
+//! @brief Instantiates the linear filter declaration, prediction, and update.
+void compile(const vector<output_size> &z) {
+  const matrix<state_size, state_size> i{
+      kalman_internal::one<matrix<state_size, state_size>>};
+
+  kalman filter{
+      state{kalman_internal::zero<vector<state_size>>},
+      output<vector<output_size>>,
+      estimate_uncertainty{i},
+      process_uncertainty{i},
+      output_uncertainty{
+          kalman_internal::one<matrix<output_size, output_size>>},
+      output_model{kalman_internal::one<matrix<output_size, state_size>>},
+      state_transition{i}};
+
+  filter.predict();
+  filter.update(z);
+}
+#else
+//! @brief Instantiates the linear control filter declaration, prediction, and
+//! update.
+void compile(const vector<output_size> &z, const vector<input_size> &u) {
+  kalman filter{state{kalman_internal::zero<vector<state_size>>},
+                output<vector<output_size>>, input<vector<input_size>>};
+
+  filter.predict(u);
+  filter.update(z);
+}
+#endif
+} // namespace fcarouge::benchmark
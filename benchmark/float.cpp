@@ -0,0 +1,87 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "benchmark.hpp"
+#include "fcarouge/kalman.hpp"
+
+namespace fcarouge::benchmark {
+namespace {
+//! @benchmark Measures the prediction of the 1x1x0 single precision filter.
+void predict_1x1x0(::benchmark::State &state) {
+  kalman filter{fcarouge::state{0.F}, output<float>, estimate_uncertainty{1.F},
+                process_uncertainty{0.1F}, output_uncertainty{0.1F}};
+
+  measure(state, [&filter] { filter.predict(); });
+}
+
+//! @benchmark Measures the update of the 1x1x0 single precision filter.
+void update_1x1x0(::benchmark::State &state) {
+  kalman filter{fcarouge::state{0.F}, output<float>, estimate_uncertainty{1.F},
+                process_uncertainty{0.1F}, output_uncertainty{0.1F}};
+
+  measure(state, [&filter] { filter.update(1.F); });
+}
+
+//! @benchmark Measures the prediction of the 1x1x1 single precision filter.
+void predict_1x1x1(::benchmark::State &state) {
+  kalman filter{fcarouge::state{0.F},      output<float>,
+                input<float>,              estimate_uncertainty{1.F},
+                process_uncertainty{0.1F}, output_uncertainty{0.1F}};
+
+  measure(state, [&filter] { filter.predict(1.F); });
+}
+
+//! @benchmark Measures the update of the 1x1x1 single precision filter.
+void update_1x1x1(::benchmark::State &state) {
+  kalman filter{fcarouge::state{0.F},      output<float>,
+                input<float>,              estimate_uncertainty{1.F},
+                process_uncertainty{0.1F}, output_uncertainty{0.1F}};
+
+  measure(state, [&filter] { filter.update(1.F); });
+}
+
+[[maybe_unused]] const auto registration{[] {
+  ::benchmark::RegisterBenchmark(name("predict", 1, 1, 0), predict_1x1x0);
+  ::benchmark::RegisterBenchmark(name("update", 1, 1, 0), update_1x1x0);
+  ::benchmark::RegisterBenchmark(name("predict", 1, 1, 1), predict_1x1x1);
+  ::benchmark::RegisterBenchmark(name("update", 1, 1, 1), update_1x1x1);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::benchmark
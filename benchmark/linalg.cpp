@@ -0,0 +1,138 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "benchmark.hpp"
+#include "fcarouge/kalman.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <cstddef>
+
+namespace fcarouge::benchmark {
+namespace {
+template <auto Size> using vector = column_vector<double, Size>;
+template <auto Row, auto Column> using matrix = matrix<double, Row, Column>;
+
+//! @brief A linear filter of the given dimensions.
+//!
+//! @details The identity model and uncertainties keep the filter numerically
+//! stable over the benchmark iterations. A zero input size selects the filter
+//! without control input.
+template <std::size_t StateSize, std::size_t OutputSize, std::size_t InputSize>
+[[nodiscard]] auto make_filter() {
+  const vector<StateSize> x{kalman_internal::zero<vector<StateSize>>};
+  const matrix<StateSize, StateSize> i{
+      kalman_internal::one<matrix<StateSize, StateSize>>};
+  const matrix<OutputSize, OutputSize> r{
+      kalman_internal::one<matrix<OutputSize, OutputSize>>};
+  const matrix<OutputSize, StateSize> h{
+      kalman_internal::one<matrix<OutputSize, StateSize>>};
+
+  if constexpr (InputSize == 0) {
+    return kalman{fcarouge::state{x},     output<vector<OutputSize>>,
+                  estimate_uncertainty{i}, process_uncertainty{i},
+                  output_uncertainty{r},   output_model{h},
+                  state_transition{i}};
+  } else {
+    const matrix<StateSize, InputSize> g{
+        kalman_internal::one<matrix<StateSize, InputSize>>};
+
+    return kalman{fcarouge::state{x},
+                  output<vector<OutputSize>>,
+                  input<vector<InputSize>>,
+                  estimate_uncertainty{i},
+                  process_uncertainty{i},
+                  output_uncertainty{r},
+                  output_model{h},
+                  state_transition{i},
+                  input_control{g}};
+  }
+}
+
+//! @benchmark Measures the prediction of the filter for the given dimensions.
+template <std::size_t StateSize, std::size_t OutputSize, std::size_t InputSize>
+void predict(::benchmark::State &state) {
+  auto filter{make_filter<StateSize, OutputSize, InputSize>()};
+
+  if constexpr (InputSize == 0) {
+    measure(state, [&filter] { filter.predict(); });
+  } else {
+    const vector<InputSize> u{kalman_internal::zero<vector<InputSize>>};
+
+    measure(state, [&filter, &u] { filter.predict(u); });
+  }
+}
+
+//! @benchmark Measures the update of the filter for the given dimensions.
+template <std::size_t StateSize, std::size_t OutputSize, std::size_t InputSize>
+void update(::benchmark::State &state) {
+  auto filter{make_filter<StateSize, OutputSize, InputSize>()};
+  const vector<OutputSize> z{kalman_internal::zero<vector<OutputSize>>};
+
+  measure(state, [&filter, &z] { filter.update(z); });
+}
+
+template <std::size_t StateSize, std::size_t OutputSize,
+          std::size_t InputSize = 0>
+void register_benchmarks() {
+  ::benchmark::RegisterBenchmark(
+      name("predict", StateSize, OutputSize, InputSize),
+      predict<StateSize, OutputSize, InputSize>);
+  ::benchmark::RegisterBenchmark(
+      name("update", StateSize, OutputSize, InputSize),
+      update<StateSize, OutputSize, InputSize>);
+}
+
+[[maybe_unused]] const auto registration{[] {
+  register_benchmarks<2, 1>();
+  register_benchmarks<4, 1>();
+  register_benchmarks<4, 2>();
+  register_benchmarks<6, 2>();
+  register_benchmarks<6, 4>();
+  register_benchmarks<8, 4>();
+  register_benchmarks<12, 3>();
+  register_benchmarks<12, 6>();
+  register_benchmarks<2, 1, 1>();
+  register_benchmarks<4, 2, 1>();
+  register_benchmarks<6, 2, 2>();
+  register_benchmarks<8, 4, 2>();
+  register_benchmarks<12, 6, 3>();
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::benchmark
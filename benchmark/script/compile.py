@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+"""
+ __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org>
+
+Measure the compile time and object size of the filter translation units.
+
+The launch command wraps the compiler of each measured object and records its
+compile time next to the object. The report command prints the compile times
+and object sizes, and fails when a translation unit exceeds the budget.
+"""
+
+import argparse
+import json
+import pathlib
+import subprocess
+import sys
+import time
+
+
+def object_path(command):
+    """The object file produced by the compiler command."""
+    for index, argument in enumerate(command):
+        if argument == "-o" and index + 1 < len(command):
+            return pathlib.Path(command[index + 1])
+        if argument.startswith(("/Fo", "-Fo")):
+            return pathlib.Path(argument[3:])
+    return None
+
+
+def launch(command):
+    """Run and time the compiler command, recording its duration."""
+    start = time.perf_counter()
+    status = subprocess.run(command, check=False).returncode
+    seconds = time.perf_counter() - start
+    path = object_path(command)
+    if status == 0 and path is not None:
+        record = path.with_name(path.name + ".json")
+        record.write_text(json.dumps({"seconds": seconds}) + "\n")
+    return status
+
+
+def report(arguments):
+    """Print the compile time and object size of each object."""
+    results = []
+    for path in map(pathlib.Path, arguments.objects):
+        record = path.with_name(path.name + ".json")
+        seconds = json.loads(record.read_text())["seconds"]
+        name = path.parent.name.removeprefix("kalman_benchmark_compile_")
+        results.append((name.removesuffix(".dir"), seconds, path.stat().st_size))
+    exceeded = []
+    print(f"{'Translation unit':<32} {'Compile time':>14} {'Object size':>14}")
+    for name, seconds, size in sorted(results):
+        print(f"{name:<32} {seconds:>12.2f} s {size:>12} B")
+        if 0 < arguments.budget < seconds:
+            exceeded.append(name)
+    if arguments.output:
+        arguments.output.write_text(
+            json.dumps(
+                {name: {"seconds": seconds, "bytes": size} for name, seconds, size in results},
+                indent=2,
+                sort_keys=True,
+            )
+            + "\n"
+        )
+    if exceeded:
+        print(
+            f"{len(exceeded)} translation units exceeded the {arguments.budget} s "
+            f"compile time budget: {', '.join(exceeded)}"
+        )
+        return 1
+    return 0
+
+
+def main():
+    if len(sys.argv) > 2 and sys.argv[1:3] == ["launch", "--"]:
+        return launch(sys.argv[3:])
+    parser = argparse.ArgumentParser(
+        description="Report the compile time and object size of the filters."
+    )
+    parser.add_argument("command", choices=["report"])
+    parser.add_argument("objects", nargs="+", help="The measured object files.")
+    parser.add_argument(
+        "--budget",
+        type=float,
+        default=0.0,
+        help="The compile time budget in seconds, zero for none.",
+    )
+    parser.add_argument(
+        "--output", type=pathlib.Path, help="The JSON file of the results."
+    )
+    arguments = parser.parse_args()
+    return report(arguments)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,210 @@
+#!/usr/bin/env python3
+"""
+ __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org>
+
+Record the benchmark results as a baseline, or compare the current results
+against the stored baseline and fail on a statistically significant predict or
+update latency regression beyond the configured threshold.
+
+Only the Python standard library is used so that the comparison runs offline.
+"""
+
+import argparse
+import json
+import math
+import pathlib
+import re
+import statistics
+import subprocess
+import sys
+import tempfile
+
+NANOSECONDS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def run(driver, repetitions, minimum_time):
+    """Run a benchmark driver and return its samples in nanoseconds by name."""
+    with tempfile.TemporaryDirectory() as directory:
+        output = pathlib.Path(directory) / "output.json"
+        subprocess.run(
+            [
+                driver,
+                f"--benchmark_min_time={minimum_time}",
+                f"--benchmark_repetitions={repetitions}",
+                "--benchmark_enable_random_interleaving=true",
+                f"--benchmark_out={output}",
+                "--benchmark_out_format=json",
+            ],
+            check=True,
+            stdout=subprocess.DEVNULL,
+        )
+        report = json.loads(output.read_text())
+    samples = {}
+    for entry in report["benchmarks"]:
+        if entry.get("run_type", "iteration") != "iteration":
+            continue
+        name = entry.get("run_name", entry["name"])
+        scale = NANOSECONDS[entry.get("time_unit", "ns")]
+        samples.setdefault(name, []).append(entry["real_time"] * scale)
+    return {"context": report.get("context", {}), "samples": samples}
+
+
+def record(arguments):
+    """Store the results of each driver as the baseline."""
+    arguments.baseline.mkdir(parents=True, exist_ok=True)
+    for driver in arguments.drivers:
+        result = run(driver, arguments.repetitions, arguments.min_time)
+        path = arguments.baseline / f"{pathlib.Path(driver).stem}.json"
+        path.write_text(json.dumps(result, indent=2, sort_keys=True) + "\n")
+        print(f"Recorded {len(result['samples'])} benchmarks in {path}")
+    return 0
+
+
+def mann_whitney(first, second):
+    """The two-sided p-value of the Mann-Whitney U test, normal approximated."""
+    values = sorted([(value, 0) for value in first] + [(value, 1) for value in second])
+    ranks = [0.0] * len(values)
+    ties = 0.0
+    index = 0
+    while index < len(values):
+        end = index
+        while end + 1 < len(values) and values[end + 1][0] == values[index][0]:
+            end += 1
+        for position in range(index, end + 1):
+            ranks[position] = (index + end) / 2.0 + 1.0
+        count = end - index + 1
+        ties += count**3 - count
+        index = end + 1
+    m, n = len(first), len(second)
+    rank_sum = sum(rank for rank, (_, group) in zip(ranks, values) if group == 0)
+    u = rank_sum - m * (m + 1) / 2.0
+    total = m + n
+    variance = m * n / 12.0 * ((total + 1) - ties / (total * (total - 1)))
+    if variance <= 0.0:
+        return 1.0
+    z = (abs(u - m * n / 2.0) - 0.5) / math.sqrt(variance)
+    return math.erfc(max(z, 0.0) / math.sqrt(2.0))
+
+
+def noise(samples):
+    """The relative noise of the samples as the scaled median absolute deviation."""
+    median = statistics.median(samples)
+    deviation = statistics.median(abs(sample - median) for sample in samples)
+    return 1.4826 * deviation / median if median > 0.0 else 0.0
+
+
+def compare(arguments):
+    """Compare each driver against its baseline and report the regressions."""
+    pattern = re.compile(arguments.filter)
+    regressions = []
+    for driver in arguments.drivers:
+        path = arguments.baseline / f"{pathlib.Path(driver).stem}.json"
+        if not path.exists():
+            print(f"No baseline {path}, record it with the baseline target.")
+            return 2
+        baseline = json.loads(path.read_text())["samples"]
+        current = run(driver, arguments.repetitions, arguments.min_time)["samples"]
+        for name in sorted(current):
+            if not pattern.search(name) or name not in baseline:
+                continue
+            before = statistics.median(baseline[name])
+            after = statistics.median(current[name])
+            change = 100.0 * (after - before) / before
+            threshold = max(
+                arguments.threshold,
+                100.0 * arguments.noise * max(noise(baseline[name]), noise(current[name])),
+            )
+            p_value = mann_whitney(baseline[name], current[name])
+            regressed = change > threshold and p_value < arguments.significance
+            print(
+                f"{'REGRESSION' if regressed else 'ok':<10} {name:<40} "
+                f"{before:>12.2f} ns {after:>12.2f} ns {change:>+8.2f}% "
+                f"(threshold {threshold:.2f}%, p {p_value:.3f})"
+            )
+            if regressed:
+                regressions.append(name)
+    if regressions:
+        print(f"{len(regressions)} benchmarks regressed: {', '.join(regressions)}")
+        return 1
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Record or compare the benchmark latency baseline."
+    )
+    parser.add_argument("command", choices=["record", "compare"])
+    parser.add_argument("drivers", nargs="+", help="The benchmark executables.")
+    parser.add_argument(
+        "--baseline",
+        type=pathlib.Path,
+        required=True,
+        help="The versioned directory of the stored baseline results.",
+    )
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=5.0,
+        help="The latency regression percent beyond which to fail.",
+    )
+    parser.add_argument(
+        "--noise",
+        type=float,
+        default=3.0,
+        help="The multiple of the relative noise widening the threshold.",
+    )
+    parser.add_argument(
+        "--significance",
+        type=float,
+        default=0.05,
+        help="The Mann-Whitney U test significance level of a regression.",
+    )
+    parser.add_argument("--repetitions", type=int, default=10)
+    parser.add_argument("--min-time", default="0.05s")
+    parser.add_argument(
+        "--filter",
+        default="predict|update",
+        help="The regular expression of the gated benchmark names.",
+    )
+    arguments = parser.parse_args()
+    return record(arguments) if arguments.command == "record" else compare(arguments)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,117 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "benchmark.hpp"
+#include "fcarouge/kalman.hpp"
+#include "fcarouge/kalman_tracker.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace fcarouge::benchmark {
+namespace {
+template <auto Size> using vector = column_vector<double, Size>;
+template <auto Row, auto Column> using matrix = matrix<double, Row, Column>;
+
+//! @benchmark Measures the prediction and update of a frame of the tracker of
+//! many objects.
+//!
+//! @details The objects move in lockstep on a square grid wider than the gates,
+//! such that each track gates its own detection among the sorted neighbors of
+//! the first element. The first frame gives birth to the tracks, the measured
+//! frames then predict, gate, assign, and update all of them.
+template <std::size_t Objects> void track(::benchmark::State &state) {
+  const kalman prototype{
+      fcarouge::state{vector<4>{0., 0., 0., 0.}},
+      output<vector<2>>,
+      estimate_uncertainty{{1., 0., 0., 0.},
+                           {0., 1., 0., 0.},
+                           {0., 0., 4., 0.},
+                           {0., 0., 0., 4.}},
+      process_uncertainty{{0.01, 0., 0., 0.},
+                          {0., 0.01, 0., 0.},
+                          {0., 0., 0.01, 0.},
+                          {0., 0., 0., 0.01}},
+      output_uncertainty{{0.25, 0.}, {0., 0.25}},
+      output_model{matrix<2, 4>{{1., 0., 0., 0.}, {0., 1., 0., 0.}}},
+      state_transition{matrix<4, 4>{{1., 0., 1., 0.},
+                                    {0., 1., 0., 1.},
+                                    {0., 0., 1., 0.},
+                                    {0., 0., 0., 1.}}}};
+
+  tracker objects{prototype,
+                  [](auto &filter, const vector<2> &z) {
+                    filter.x(z(0), z(1), 0., 0.);
+                  },
+                  Objects};
+
+  std::size_t side{1};
+  while (side * side < Objects) {
+    ++side;
+  }
+  std::vector<vector<2>> detections(Objects);
+  double frame{0.};
+  const auto observe{[&detections, &frame, side] {
+    for (std::size_t object{0}; object < detections.size(); ++object) {
+      detections[object] =
+          vector<2>{20. * static_cast<double>(object % side) + 0.1 * frame,
+                    20. * static_cast<double>(object / side) + 0.05 * frame};
+    }
+    frame += 1.;
+  }};
+
+  observe();
+  objects.update(std::span<const vector<2>>{detections});
+
+  measure(state, [&objects, &detections, &observe] {
+    observe();
+    objects.predict();
+    objects.update(std::span<const vector<2>>{detections});
+  });
+}
+
+[[maybe_unused]] const auto registration{[] {
+  ::benchmark::RegisterBenchmark(name("track", 4, 2, 0) + "_10000",
+                                 track<10000>)
+      ->Unit(::benchmark::kMillisecond);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::benchmark
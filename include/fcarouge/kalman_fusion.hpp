@@ -0,0 +1,65 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_FUSION_HPP
+#define FCAROUGE_KALMAN_FUSION_HPP
+
+//! @file
+//! @brief The multi-rate sensor fusion front-end.
+//!
+//! @details Provides the lock-free measurement queues driving a filter from
+//! several asynchronous sensors. Include with the header of the driven filter.
+
+#include "kalman_internal/fusion.hpp"
+
+namespace fcarouge {
+//! @name Estimators
+//! @{
+
+//! @brief Multi-rate asynchronous sensor fusion front-end of a filter.
+//!
+//! @details Queues the timestamped measurements of several sensors without
+//! locks, and drives the predictions to the measurement times and the updates
+//! of the named sensors of the filter. Declared from the filter, the start
+//! time, and the named sensors, one per queue.
+using kalman_internal::fusion;
+
+//! @}
+} // namespace fcarouge
+
+#endif // FCAROUGE_KALMAN_FUSION_HPP
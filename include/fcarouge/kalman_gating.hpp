@@ -0,0 +1,70 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_GATING_HPP
+#define FCAROUGE_KALMAN_GATING_HPP
+
+//! @file
+//! @brief The gating and association decorator.
+//!
+//! @details Provides the filter decorator of the Mahalanobis gating and
+//! probabilistic association of candidate measurements. Include with the header
+//! of the decorated filter.
+
+#include "kalman_internal/factorization.hpp"
+
+namespace fcarouge {
+//! @name Decorators
+//! @{
+
+//! @brief Filter decorator of the gating and association of candidate
+//! measurements.
+//!
+//! @details Pipe decorator to filter declaration to evaluate the squared
+//! Mahalanobis distances and log-likelihoods of batches of candidate
+//! measurements with `mahalanobis()`, and to update the estimates with
+//! probabilistically associated candidates with `associate()`. The
+//! factorization of the innovation uncertainty is cached until the next
+//! prediction, update, or change of P, H, or R. Opt-in, the undecorated filters
+//! do not store it. Takes no parameters.
+inline constexpr gater gating;
+
+//! @}
+} // namespace fcarouge
+
+#endif // FCAROUGE_KALMAN_GATING_HPP
@@ -0,0 +1,175 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_INTERNAL_ADAPTIVE_HPP
+#define FCAROUGE_KALMAN_INTERNAL_ADAPTIVE_HPP
+
+#include "utility.hpp"
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace fcarouge {
+//! @brief Sage-Husa adaptive noise estimation parameters.
+//!
+//! @details The `forgetting` factor `b` of the exponential window, close to
+//! but less than one, and whether to adapt the process uncertainty Q and the
+//! output uncertainty R. Only R is adapted by default.
+struct sage_husa {
+  double forgetting{0.98};
+  bool q{false};
+  bool r{true};
+};
+
+//! @brief Covariance matching adaptive noise estimation parameters.
+//!
+//! @details The `forgetting` factor `b` of the exponential window of the
+//! innovation covariance, close to but less than one, and whether to adapt the
+//! process uncertainty Q and the output uncertainty R. Only R is adapted by
+//! default.
+struct covariance_matching {
+  double forgetting{0.98};
+  bool q{false};
+  bool r{true};
+};
+
+namespace kalman_internal {
+//! @brief Filter decorator of the adaptive process and output uncertainties.
+//!
+//! @details Estimates the process uncertainty Q and the output uncertainty R
+//! online from the innovation Y, the innovation uncertainty S, and the gain K
+//! of each update, in constant time and memory. The weight of the update of
+//! index `k` is `d = (1 - b) / (1 - bᵏ⁺¹)`, an exponential window of
+//! forgetting factor `b` corrected for its start.
+//!
+//! The Sage-Husa method updates `R += d * (Y * Yᵀ - S)` and
+//! `Q += d * K * (Y * Yᵀ - S) * Kᵀ`, using `H * P * Hᵀ = S - R` and
+//! `P⁺ - F * P⁺ * Fᵀ = Q - K * S * Kᵀ`. The covariance matching method
+//! averages the innovation covariance `C = (1 - d) * C + d * Y * Yᵀ`, and
+//! matches `R = C - (S - R)` and `Q = K * C * Kᵀ`.
+//!
+//! The estimates are not constrained to be positive definite: the forgetting
+//! factor must average enough innovations for the filter characteristics. The
+//! innovations do not generally discern Q from R, adapting both at once may
+//! diverge.
+//!
+//! @tparam Filter The decorated `kalman` filter, exposing its innovation,
+//! innovation uncertainty, and gain, and with process and output uncertainty
+//! matrices.
+//! @tparam Method The `sage_husa` or `covariance_matching` parameters type.
+//!
+//! @pre The forgetting factor is in the open interval `(0, 1)`: one divides
+//! the first weight by zero, and above one the weights are negative.
+template <typename Filter, typename Method> class adaptive : public Filter {
+public:
+  using process_uncertainty = Filter::process_uncertainty;
+  using output_uncertainty = Filter::output_uncertainty;
+  using innovation = Filter::innovation;
+  using innovation_uncertainty = Filter::innovation_uncertainty;
+  using gain = Filter::gain;
+  using value = std::remove_cvref_t<decltype(element(
+      std::declval<innovation &>(), std::size_t{0}))>;
+
+  constexpr adaptive(Filter &&filter, const Method &method);
+
+  using Filter::update;
+
+  constexpr void update(const auto &...arguments);
+
+private:
+  Method parameters;
+  value power{1};
+  innovation_uncertainty covariance{zero<innovation_uncertainty>};
+};
+
+template <typename Filter, typename Method>
+constexpr adaptive<Filter, Method>::adaptive(Filter &&filter,
+                                             const Method &method)
+    : Filter{std::forward<Filter>(filter)}, parameters{method} {
+  assert(parameters.forgetting > 0. && parameters.forgetting < 1. &&
+         "The forgetting factor must be in the open interval (0, 1).");
+}
+
+template <typename Filter, typename Method>
+constexpr void adaptive<Filter, Method>::update(const auto &...arguments) {
+  const output_uncertainty r{Filter::r()};
+  const process_uncertainty q{Filter::q()};
+
+  Filter::update(arguments...);
+
+  const value forgetting{static_cast<value>(parameters.forgetting)};
+  power *= forgetting;
+  const value d{(1 - forgetting) / (1 - power)};
+  const innovation &y{Filter::y()};
+  const innovation_uncertainty &s{Filter::s()};
+  const gain &k{Filter::k()};
+
+  if constexpr (std::same_as<Method, sage_husa>) {
+    const innovation_uncertainty mismatch{y * t(y) - s};
+    if (parameters.r) {
+      Filter::r(output_uncertainty{r + d * mismatch});
+    }
+    if (parameters.q) {
+      Filter::q(process_uncertainty{q + d * k * mismatch * t(k)});
+    }
+  } else {
+    covariance =
+        innovation_uncertainty{(1 - d) * covariance + d * y * t(y)};
+    if (parameters.r) {
+      Filter::r(output_uncertainty{covariance - s + r});
+    }
+    if (parameters.q) {
+      Filter::q(process_uncertainty{k * covariance * t(k)});
+    }
+  }
+}
+} // namespace kalman_internal
+
+template <typename Filter, typename Method>
+  requires std::same_as<Method, sage_husa> ||
+           std::same_as<Method, covariance_matching>
+[[nodiscard]] constexpr auto operator|(Filter &&filter, const Method &method) {
+  return kalman_internal::adaptive<Filter, Method>(std::forward<Filter>(filter),
+                                                   method);
+}
+} // namespace fcarouge
+
+#endif // FCAROUGE_KALMAN_INTERNAL_ADAPTIVE_HPP
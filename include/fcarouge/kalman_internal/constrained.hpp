@@ -0,0 +1,204 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_INTERNAL_CONSTRAINED_HPP
+#define FCAROUGE_KALMAN_INTERNAL_CONSTRAINED_HPP
+
+#include "utility.hpp"
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace fcarouge::kalman_internal {
+// The filter projecting its estimate on the declared linear constraints after
+// each update of the constrained filter. The equality constraint `D * x = d` is
+// enforced by the least squares projector `M = I - Dᵀ * (D * Dᵀ)⁻¹ * D` and
+// offset `Dᵀ * (D * Dᵀ)⁻¹ * d` precomputed at construction: `x = M * x +
+// offset` and `P = M * P * Mᵀ`. The violated inequality constraints are then
+// activated one at a time, the most violated first, each projecting the state
+// on its boundary within the subspace of the previously enforced constraints.
+// Without violated inequalities, the update costs the fixed projection.
+template <typename Filter, typename... Constraints>
+struct constrained : public Filter {
+  using state = Filter::state;
+  using estimate_uncertainty = Filter::estimate_uncertainty;
+  using scalar = std::remove_cvref_t<decltype(element(
+      std::declval<state &>(), std::size_t{0}))>;
+  using distance = evaluate<product<evaluate<transpose<state>>, state>>;
+
+  // The transposed model, one constraint normal per column, and the value of a
+  // constraint.
+  template <typename Constraint> struct boundary {
+    static constexpr bool equality{Constraint::equality};
+
+    using values = decltype(Constraint::value);
+    using normals = evaluate<quotient<state, values>>;
+
+    static constexpr std::size_t rows{dimension<values>};
+
+    constexpr explicit boundary(const Constraint &declaration)
+        : n{t(declaration.model)}, d{declaration.value} {}
+
+    normals n;
+    values d;
+  };
+
+  static constexpr std::size_t equalities{
+      (std::size_t{0} + ... + std::size_t{Constraints::equality})};
+
+  static constexpr std::size_t inequalities{
+      (std::size_t{0} + ... +
+       (Constraints::equality ? 0 : boundary<Constraints>::rows))};
+
+  std::tuple<boundary<Constraints>...> boundaries;
+  estimate_uncertainty projector{one<estimate_uncertainty>};
+  state offset{zero<state>};
+
+  constexpr constrained(Filter &&filter, const Constraints &...declarations)
+      : Filter{std::forward<Filter>(filter)},
+        boundaries{boundary<Constraints>{declarations}...} {
+    static_assert(has_state_member<Filter> &&
+                      has_estimate_uncertainty_member<Filter>,
+                  "The constrained filter must hold its state and estimate "
+                  "uncertainty.");
+    static_assert(equalities <= 1,
+                  "The equality constraints must be declared in one model.");
+
+    (..., [this](const auto &declaration) {
+      using declaration_type = std::remove_cvref_t<decltype(declaration)>;
+
+      if constexpr (declaration_type::equality) {
+        using model = decltype(declaration_type::model);
+        using correction_type =
+            evaluate<quotient<evaluate<transpose<model>>, ᴀʙᵀ<model, model>>>;
+
+        const model &d{declaration.model};
+        const correction_type correction{t(d) / (d * t(d))};
+        projector = estimate_uncertainty{one<estimate_uncertainty> -
+                                         correction * d};
+        offset = state{correction * declaration.value};
+      }
+    }(declarations));
+  }
+
+  // The scalar product of two states.
+  static constexpr scalar dot(const state &lhs, const state &rhs) {
+    distance product{t(lhs) * rhs};
+    return element(product, 0);
+  }
+
+  constexpr void update(const auto &...arguments) {
+    Filter::update(arguments...);
+    project();
+  }
+
+  constexpr void project() {
+    if constexpr (equalities > 0) {
+      this->x = state{projector * this->x + offset};
+    }
+
+    estimate_uncertainty metric{projector};
+    bool projected{equalities > 0};
+
+    if constexpr (inequalities > 0) {
+      std::array<bool, inequalities> active{};
+
+      for (std::size_t iteration{0}; iteration < inequalities; ++iteration) {
+        std::size_t selected{inequalities};
+        scalar excess{0};
+        state normal{zero<state>};
+        std::size_t row{0};
+
+        std::apply(
+            [&](auto &...constraints) {
+              (..., [&](auto &constraint) {
+                if constexpr (!std::remove_cvref_t<
+                                  decltype(constraint)>::equality) {
+                  for (std::size_t index{0}; index < constraint.rows;
+                       ++index, ++row) {
+                    if (active[row]) {
+                      continue;
+                    }
+
+                    const state a{column(constraint.n, index)};
+                    const scalar violation{dot(a, this->x) -
+                                           element(constraint.d, index)};
+
+                    if (violation > excess) {
+                      selected = row;
+                      excess = violation;
+                      normal = a;
+                    }
+                  }
+                }
+              }(constraints));
+            },
+            boundaries);
+
+        if (selected == inequalities) {
+          break;
+        }
+
+        active[selected] = true;
+        const state g{metric * normal};
+        const scalar curvature{dot(normal, g)};
+
+        // The constraint is dependent on the already enforced constraints.
+        if (curvature <=
+            std::numeric_limits<scalar>::epsilon() * dot(normal, normal)) {
+          continue;
+        }
+
+        this->x = state{this->x - g * (excess / curvature)};
+        metric = estimate_uncertainty{metric - g * t(g) / curvature};
+        projected = true;
+      }
+    }
+
+    if (projected) {
+      this->p = estimate_uncertainty{metric * this->p * t(metric)};
+    }
+  }
+};
+} // namespace fcarouge::kalman_internal
+
+#endif // FCAROUGE_KALMAN_INTERNAL_CONSTRAINED_HPP
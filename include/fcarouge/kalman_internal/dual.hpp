@@ -0,0 +1,290 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_INTERNAL_DUAL_HPP
+#define FCAROUGE_KALMAN_INTERNAL_DUAL_HPP
+
+#include "utility.hpp"
+
+#include <array>
+#include <cmath>
+#include <compare>
+#include <cstddef>
+#include <utility>
+
+namespace fcarouge::kalman_internal {
+//! @brief Forward-mode automatic differentiation dual number.
+//!
+//! @details The `value` and the `Size` partial derivatives `tangent` of the
+//! value with respect to the differentiation variables. The arithmetic and the
+//! elementary functions propagate the value and all the partial derivatives in
+//! a single evaluation. The compile-time sized tangent lets the compiler
+//! vectorize the propagation. Conversion from the scalar type is implicit for
+//! the constants.
+template <typename Type, std::size_t Size> struct dual {
+  using type = Type;
+
+  Type value{};
+  std::array<Type, Size> tangent{};
+
+  constexpr dual() = default;
+
+  constexpr dual(Type v) : value{v} {}
+
+  constexpr dual(Type v, const std::array<Type, Size> &t)
+      : value{v}, tangent{t} {}
+
+  //! @brief The dual number of the `v` value of the `index` variable.
+  [[nodiscard]] static constexpr auto variable(Type v, std::size_t index)
+      -> dual {
+    dual result{v};
+    result.tangent[index] = Type{1};
+    return result;
+  }
+
+  [[nodiscard]] friend constexpr bool operator==(const dual &lhs,
+                                                 const dual &rhs) {
+    return lhs.value == rhs.value;
+  }
+
+  [[nodiscard]] friend constexpr auto operator<=>(const dual &lhs,
+                                                  const dual &rhs) {
+    return lhs.value <=> rhs.value;
+  }
+
+  [[nodiscard]] friend constexpr auto operator+(const dual &rhs) -> dual {
+    return rhs;
+  }
+
+  [[nodiscard]] friend constexpr auto operator-(const dual &rhs) -> dual {
+    return chain(-rhs.value, rhs, Type{-1});
+  }
+
+  [[nodiscard]] friend constexpr auto operator+(const dual &lhs,
+                                                const dual &rhs) -> dual {
+    return chain(lhs.value + rhs.value, lhs, Type{1}, rhs, Type{1});
+  }
+
+  [[nodiscard]] friend constexpr auto operator-(const dual &lhs,
+                                                const dual &rhs) -> dual {
+    return chain(lhs.value - rhs.value, lhs, Type{1}, rhs, Type{-1});
+  }
+
+  [[nodiscard]] friend constexpr auto operator*(const dual &lhs,
+                                                const dual &rhs) -> dual {
+    return chain(lhs.value * rhs.value, lhs, rhs.value, rhs, lhs.value);
+  }
+
+  [[nodiscard]] friend constexpr auto operator/(const dual &lhs,
+                                                const dual &rhs) -> dual {
+    const Type ratio{lhs.value / rhs.value};
+    return chain(ratio, lhs, Type{1} / rhs.value, rhs, -ratio / rhs.value);
+  }
+
+  constexpr auto operator+=(const dual &rhs) -> dual & {
+    return *this = *this + rhs;
+  }
+
+  constexpr auto operator-=(const dual &rhs) -> dual & {
+    return *this = *this - rhs;
+  }
+
+  constexpr auto operator*=(const dual &rhs) -> dual & {
+    return *this = *this * rhs;
+  }
+
+  constexpr auto operator/=(const dual &rhs) -> dual & {
+    return *this = *this / rhs;
+  }
+
+  [[nodiscard]] friend auto sqrt(const dual &x) -> dual {
+    using std::sqrt;
+    const Type root{sqrt(x.value)};
+    return chain(root, x, Type{1} / (Type{2} * root));
+  }
+
+  [[nodiscard]] friend auto exp(const dual &x) -> dual {
+    using std::exp;
+    const Type power{exp(x.value)};
+    return chain(power, x, power);
+  }
+
+  [[nodiscard]] friend auto log(const dual &x) -> dual {
+    using std::log;
+    return chain(log(x.value), x, Type{1} / x.value);
+  }
+
+  [[nodiscard]] friend auto pow(const dual &x, Type exponent) -> dual {
+    using std::pow;
+    return chain(pow(x.value, exponent), x,
+                 exponent * pow(x.value, exponent - Type{1}));
+  }
+
+  [[nodiscard]] friend auto pow(const dual &x, const dual &exponent) -> dual {
+    using std::log;
+    using std::pow;
+    const Type power{pow(x.value, exponent.value)};
+    return chain(power, x,
+                 exponent.value * pow(x.value, exponent.value - Type{1}),
+                 exponent, power * log(x.value));
+  }
+
+  [[nodiscard]] friend auto abs(const dual &x) -> dual {
+    return x.value < Type{0} ? -x : x;
+  }
+
+  [[nodiscard]] friend auto sin(const dual &x) -> dual {
+    using std::cos;
+    using std::sin;
+    return chain(sin(x.value), x, cos(x.value));
+  }
+
+  [[nodiscard]] friend auto cos(const dual &x) -> dual {
+    using std::cos;
+    using std::sin;
+    return chain(cos(x.value), x, -sin(x.value));
+  }
+
+  [[nodiscard]] friend auto tan(const dual &x) -> dual {
+    using std::tan;
+    const Type slope{tan(x.value)};
+    return chain(slope, x, Type{1} + slope * slope);
+  }
+
+  [[nodiscard]] friend auto asin(const dual &x) -> dual {
+    using std::asin;
+    using std::sqrt;
+    return chain(asin(x.value), x,
+                 Type{1} / sqrt(Type{1} - x.value * x.value));
+  }
+
+  [[nodiscard]] friend auto acos(const dual &x) -> dual {
+    using std::acos;
+    using std::sqrt;
+    return chain(acos(x.value), x,
+                 Type{-1} / sqrt(Type{1} - x.value * x.value));
+  }
+
+  [[nodiscard]] friend auto atan(const dual &x) -> dual {
+    using std::atan;
+    return chain(atan(x.value), x, Type{1} / (Type{1} + x.value * x.value));
+  }
+
+  [[nodiscard]] friend auto atan2(const dual &y, const dual &x) -> dual {
+    using std::atan2;
+    const Type norm{x.value * x.value + y.value * y.value};
+    return chain(atan2(y.value, x.value), y, x.value / norm, x,
+                 -y.value / norm);
+  }
+
+private:
+  // The chain rule of the `primal` result of a function of the `operands` dual
+  // numbers, each operand followed by its partial derivative.
+  template <typename... Operands>
+  [[nodiscard]] static constexpr auto chain(Type primal,
+                                            const Operands &...operands)
+      -> dual {
+    dual result{primal};
+    accumulate(result, operands...);
+    return result;
+  }
+
+  static constexpr void accumulate([[maybe_unused]] dual &result) {}
+
+  template <typename... Operands>
+  static constexpr void accumulate(dual &result, const dual &operand,
+                                   Type derivative,
+                                   const Operands &...operands) {
+    for (std::size_t index{0}; index < Size; ++index) {
+      result.tangent[index] += derivative * operand.tangent[index];
+    }
+    accumulate(result, operands...);
+  }
+};
+
+//! @brief Specialization of the element access.
+//!
+//! @details A dual number is a singleton.
+template <typename Type, std::size_t Size> struct elements<dual<Type, Size>> {
+  [[nodiscard]] static constexpr auto &
+  operator()(dual<Type, Size> &value, [[maybe_unused]] std::size_t index) {
+    return value;
+  }
+};
+
+//! @brief Jacobian of a function by forward-mode automatic differentiation.
+//!
+//! @details Computes the `Jacobian` matrix `∂function/∂x` of the `function`
+//! evaluated at the `x` column vector with the additional `arguments`. The
+//! function is evaluated once over the differentiable column vector seeded with
+//! the identity tangents. No finite difference step is involved: the result is
+//! exact to the floating point rounding. The function must be generic over the
+//! scalar type of its first parameter.
+template <typename Jacobian, typename State, typename Function,
+          typename... Arguments>
+[[nodiscard]] constexpr auto jacobian(Function &&function, const State &x,
+                                      const Arguments &...arguments)
+    -> Jacobian {
+  using variable = dual<scalar_of<State>, dimension<State>>;
+
+  State state_x{x};
+  differentiable<State> seed{};
+  for (std::size_t index{0}; index < dimension<State>; ++index) {
+    element(seed, index) = variable::variable(element(state_x, index), index);
+  }
+
+  auto result{std::forward<Function>(function)(std::as_const(seed),
+                                               arguments...)};
+  Jacobian j{};
+  for (std::size_t row{0}; row < dimension<decltype(result)>; ++row) {
+    const variable &output_row{element(result, row)};
+    for (std::size_t column{0}; column < dimension<State>; ++column) {
+      if constexpr (algebraic<Jacobian>) {
+        j(static_cast<int>(row), static_cast<int>(column)) =
+            output_row.tangent[column];
+      } else {
+        j = output_row.tangent[column];
+      }
+    }
+  }
+
+  return j;
+}
+} // namespace fcarouge::kalman_internal
+
+#endif // FCAROUGE_KALMAN_INTERNAL_DUAL_HPP
@@ -0,0 +1,334 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_INTERNAL_FACTORIZATION_HPP
+#define FCAROUGE_KALMAN_INTERNAL_FACTORIZATION_HPP
+
+#include "sampling.hpp"
+#include "utility.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace fcarouge {
+namespace kalman_internal {
+//! @brief Filter decorator of the gating and association of candidate
+//! measurements.
+//!
+//! @details Evaluates batches of candidate measurements against the predicted
+//! measurement `H * X` with the innovation uncertainty `S = H * P * Hᵀ + R`,
+//! and updates the estimates with probabilistically associated candidates.
+//! The whitening inverse `L⁻¹` of the lower triangular factor `L * Lᵀ = S`
+//! and the logarithm of the determinant of S are cached. The predictions, the
+//! updates, and the writes of P, H, or R mark the cache dirty, the next
+//! evaluation factors S again. For multiple target tracking.
+//!
+//! @tparam Filter The decorated `kalman` filter, exposing its output model H,
+//! output uncertainty R, and estimate uncertainty P.
+template <typename Filter>
+  requires has_output_model<Filter> && has_output_uncertainty<Filter> &&
+           has_estimate_uncertainty<Filter>
+class gater : public Filter {
+public:
+  using state = Filter::state;
+  using output = Filter::output;
+  using estimate_uncertainty = Filter::estimate_uncertainty;
+  using output_model = Filter::output_model;
+  using output_uncertainty = Filter::output_uncertainty;
+  using innovation_uncertainty = ᴀʙᵀ<output, output>;
+  using gain = evaluate<quotient<state, output>>;
+  using scalar = std::remove_cvref_t<decltype(element(
+      std::declval<state &>(), std::size_t{0}))>;
+
+  constexpr explicit gater(Filter &&filter);
+
+  //! @brief Evaluates the squared Mahalanobis distances and log-likelihoods of
+  //! the candidates.
+  //!
+  //! @details For gating the measurements, for example against a chi-square
+  //! quantile. For extended filters, H is the last evaluated Jacobian.
+  //!
+  //! @param candidates The random access range of candidate measurements, of
+  //! the output type.
+  //! @param distances The random access range of the squared Mahalanobis
+  //! distances of the candidates, written.
+  //! @param likelihoods The random access range of the logarithms of the
+  //! likelihoods of the candidates, written.
+  //!
+  //! @complexity Linear in the number of candidates. Quadratic in the output
+  //! dimension per candidate.
+  constexpr void mahalanobis(const auto &candidates, auto &&distances,
+                             auto &&likelihoods);
+
+  //! @brief Evaluates the squared Mahalanobis distances of the candidates.
+  //!
+  //! @param candidates The random access range of candidate measurements, of
+  //! the output type.
+  //! @param distances The random access range of the squared Mahalanobis
+  //! distances of the candidates, written.
+  //!
+  //! @complexity Linear in the number of candidates. Quadratic in the output
+  //! dimension per candidate.
+  constexpr void mahalanobis(const auto &candidates, auto &&distances);
+
+  //! @brief Returns the innovation uncertainty `S = H * P * Hᵀ + R` of the
+  //! predicted measurement, factored if the cache is dirty.
+  [[nodiscard]] constexpr auto uncertainty() -> const innovation_uncertainty &;
+
+  //! @brief Updates the estimates with the candidates weighted by their
+  //! association probabilities.
+  //!
+  //! @details The probabilistic data association (PDA) update, the per-track
+  //! update of the joint probabilistic data association (JPDA). The combined
+  //! innovation `ν = Σ βᵢ * νᵢ` corrects the state with the gain
+  //! `K = P * Hᵀ * S⁻¹`. The complement of the sum of the probabilities is the
+  //! probability that none of the candidates is correct. The estimate
+  //! uncertainty is the mixture
+  //! `P - Σ βᵢ * K * S * Kᵀ + K * (Σ βᵢ * νᵢ * νᵢᵀ - ν * νᵀ) * Kᵀ` of the
+  //! prior and of the updated uncertainties, with the spread of the
+  //! innovations. One pass over the candidates accumulates the sums.
+  //!
+  //! @param candidates The random access range of gated candidate measurements,
+  //! of the output type.
+  //! @param probabilities The random access range of the association
+  //! probabilities of the candidates.
+  //!
+  //! @complexity Linear in the number of candidates.
+  constexpr void associate(const auto &candidates, const auto &probabilities);
+
+  using Filter::predict;
+  using Filter::update;
+
+  //! @brief Read, write the estimate uncertainty P of the decorated filter.
+  //!
+  //! @details Any write, and any mutable access, marks the cache dirty.
+  constexpr decltype(auto) p(this auto &&self, const auto &...values);
+
+  //! @brief Read, write the output model H of the decorated filter.
+  //!
+  //! @details Any write, and any mutable access, marks the cache dirty.
+  constexpr decltype(auto) h(this auto &&self, const auto &...values);
+
+  //! @brief Read, write the output uncertainty R of the decorated filter.
+  //!
+  //! @details Any write, and any mutable access, marks the cache dirty.
+  constexpr decltype(auto) r(this auto &&self, const auto &...values);
+
+  constexpr void predict(const auto &...arguments);
+
+  constexpr void update(const auto &...arguments);
+
+private:
+  // Factors the innovation uncertainty if the cache is dirty.
+  constexpr void factorize();
+
+  innovation_uncertainty s{zero<innovation_uncertainty>};
+  innovation_uncertainty whitening{zero<innovation_uncertainty>};
+  scalar normalization{0};
+  bool factored{false};
+};
+
+template <typename Filter>
+  requires has_output_model<Filter> && has_output_uncertainty<Filter> &&
+           has_estimate_uncertainty<Filter>
+constexpr gater<Filter>::gater(Filter &&filter)
+    : Filter{std::forward<Filter>(filter)} {}
+
+template <typename Filter>
+  requires has_output_model<Filter> && has_output_uncertainty<Filter> &&
+           has_estimate_uncertainty<Filter>
+constexpr void gater<Filter>::mahalanobis(const auto &candidates,
+                                          auto &&distances,
+                                          auto &&likelihoods) {
+  using distance = evaluate<product<evaluate<transpose<output>>, output>>;
+
+  factorize();
+
+  const output predicted{Filter::h() * Filter::x()};
+  for (std::size_t index{0}; index < std::ranges::size(candidates); ++index) {
+    const output whitened{whitening * (candidates[index] - predicted)};
+    distance squared{t(whitened) * whitened};
+    distances[index] = element(squared, 0);
+    likelihoods[index] = -(element(squared, 0) + normalization) / 2;
+  }
+}
+
+template <typename Filter>
+  requires has_output_model<Filter> && has_output_uncertainty<Filter> &&
+           has_estimate_uncertainty<Filter>
+constexpr void gater<Filter>::mahalanobis(const auto &candidates,
+                                          auto &&distances) {
+  using distance = evaluate<product<evaluate<transpose<output>>, output>>;
+
+  factorize();
+
+  const output predicted{Filter::h() * Filter::x()};
+  for (std::size_t index{0}; index < std::ranges::size(candidates); ++index) {
+    const output whitened{whitening * (candidates[index] - predicted)};
+    distance squared{t(whitened) * whitened};
+    distances[index] = element(squared, 0);
+  }
+}
+
+template <typename Filter>
+  requires has_output_model<Filter> && has_output_uncertainty<Filter> &&
+           has_estimate_uncertainty<Filter>
+constexpr auto gater<Filter>::uncertainty() -> const innovation_uncertainty & {
+  factorize();
+
+  return s;
+}
+
+template <typename Filter>
+  requires has_output_model<Filter> && has_output_uncertainty<Filter> &&
+           has_estimate_uncertainty<Filter>
+constexpr void gater<Filter>::associate(const auto &candidates,
+                                        const auto &probabilities) {
+  factorize();
+
+  const state &x{Filter::x()};
+  const estimate_uncertainty &pp{Filter::p()};
+  const output_model &hh{Filter::h()};
+  const output predicted{hh * x};
+  output combined{zero<output>};
+  innovation_uncertainty spread{zero<innovation_uncertainty>};
+  scalar associated{0};
+  for (std::size_t index{0}; index < std::ranges::size(candidates); ++index) {
+    const scalar probability{probabilities[index]};
+    const output y{candidates[index] - predicted};
+    combined = output{combined + probability * y};
+    spread = innovation_uncertainty{spread + probability * y * t(y)};
+    associated += probability;
+  }
+
+  const gain k{pp * t(hh) * t(whitening) * whitening};
+  spread = innovation_uncertainty{spread - combined * t(combined)};
+  const state updated_x{x + k * combined};
+  const estimate_uncertainty updated_p{pp - associated * k * s * t(k) +
+                                       k * spread * t(k)};
+  Filter::x(updated_x);
+  Filter::p(updated_p);
+  factored = false;
+}
+
+template <typename Filter>
+  requires has_output_model<Filter> && has_output_uncertainty<Filter> &&
+           has_estimate_uncertainty<Filter>
+constexpr decltype(auto) gater<Filter>::p(this auto &&self,
+                                           const auto &...values) {
+  if constexpr (sizeof...(values) ||
+                !std::is_const_v<std::remove_reference_t<decltype(self)>>) {
+    self.factored = false;
+  }
+  return std::forward<decltype(self)>(self).Filter::p(values...);
+}
+
+template <typename Filter>
+  requires has_output_model<Filter> && has_output_uncertainty<Filter> &&
+           has_estimate_uncertainty<Filter>
+constexpr decltype(auto) gater<Filter>::h(this auto &&self,
+                                           const auto &...values) {
+  if constexpr (sizeof...(values) ||
+                !std::is_const_v<std::remove_reference_t<decltype(self)>>) {
+    self.factored = false;
+  }
+  return std::forward<decltype(self)>(self).Filter::h(values...);
+}
+
+template <typename Filter>
+  requires has_output_model<Filter> && has_output_uncertainty<Filter> &&
+           has_estimate_uncertainty<Filter>
+constexpr decltype(auto) gater<Filter>::r(this auto &&self,
+                                           const auto &...values) {
+  if constexpr (sizeof...(values) ||
+                !std::is_const_v<std::remove_reference_t<decltype(self)>>) {
+    self.factored = false;
+  }
+  return std::forward<decltype(self)>(self).Filter::r(values...);
+}
+
+template <typename Filter>
+  requires has_output_model<Filter> && has_output_uncertainty<Filter> &&
+           has_estimate_uncertainty<Filter>
+constexpr void gater<Filter>::predict(const auto &...arguments) {
+  Filter::predict(arguments...);
+  factored = false;
+}
+
+template <typename Filter>
+  requires has_output_model<Filter> && has_output_uncertainty<Filter> &&
+           has_estimate_uncertainty<Filter>
+constexpr void gater<Filter>::update(const auto &...arguments) {
+  Filter::update(arguments...);
+  factored = false;
+}
+
+template <typename Filter>
+  requires has_output_model<Filter> && has_output_uncertainty<Filter> &&
+           has_estimate_uncertainty<Filter>
+constexpr void gater<Filter>::factorize() {
+  if (factored) {
+    return;
+  }
+
+  const output_model &hh{Filter::h()};
+  s = innovation_uncertainty{hh * Filter::p() * t(hh) + Filter::r()};
+  const auto l{factor(s)};
+  whitening = innovation_uncertainty{one<innovation_uncertainty> / l};
+  using std::log;
+  normalization = 2 * log(determinant(l)) +
+                  static_cast<scalar>(dimension<output>) *
+                      log(2 * std::numbers::pi_v<scalar>);
+  factored = true;
+}
+} // namespace kalman_internal
+
+struct gater {};
+
+template <typename Filter>
+[[nodiscard]] constexpr auto
+operator|(Filter &&filter, [[maybe_unused]] const gater &decorator) {
+  return kalman_internal::gater<Filter>(std::forward<Filter>(filter));
+}
+} // namespace fcarouge
+
+#endif // FCAROUGE_KALMAN_INTERNAL_FACTORIZATION_HPP
@@ -40,22 +40,41 @@ For more information, please refer to <https://unlicense.org> */
 #define FCAROUGE_KALMAN_INTERNAL_FACTORY_HPP
 
 #include "type.hpp"
-#include "x_z_p_q_r.hpp"
-#include "x_z_p_q_r_h_f.hpp"
-#include "x_z_p_q_r_hh_f_us_ps.hpp"
-#include "x_z_p_q_r_hh_ff_ps.hpp"
-#include "x_z_p_qq_rr_f.hpp"
-#include "x_z_p_r.hpp"
-#include "x_z_p_r_f.hpp"
-#include "x_z_u_p_q_r.hpp"
-#include "x_z_u_p_q_r_h_f_g_us_ps.hpp"
-#include "x_z_u_p_qq_r_ff_gg_ps.hpp"
+#include "utility.hpp"
 
 #include <concepts>
+#include <cstddef>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 
 namespace fcarouge::kalman_internal {
+// The filter specializations are only declared for the deducer to name them.
+// Their definitions are included by the translation units declaring them, such
+// that only the deduced filters are parsed and instantiated.
+template <typename> struct x_z_p_r;
+template <typename> struct x_z_p_q_r;
+template <typename> struct x_z_u_p_q_r;
+template <typename> struct x_z_p_r_f;
+template <typename, typename> struct x_z_p_q_r_h_f;
+template <typename, typename> struct x_z_p_qq_rr_f;
+template <typename, typename, typename, typename> struct x_z_p_q_r_hh_f_us_ps;
+template <typename, typename, typename> struct x_z_p_q_r_hh_ff_ps;
+template <typename, typename, typename, typename, typename>
+struct x_z_p_q_r_hh_ff_es_ps;
+template <typename, typename, typename, typename, typename>
+struct x_z_u_p_q_r_h_f_g_us_ps;
+template <typename, typename, typename, typename, typename>
+struct x_z_u_p_qq_r_ff_gg_ps;
+template <typename, typename, typename, typename, typename>
+struct x_z_p_q_r_ff_hh_sp_us_ps;
+template <typename, typename, typename, typename, typename>
+struct x_z_p_q_r_ff_hh_en_us_ps;
+template <typename, typename, typename, typename, typename>
+struct x_z_p_q_r_ff_hh_pa_us_ps;
+template <typename, typename, typename...> struct x_z_p_q_r_h_f_ss;
+template <typename, typename...> struct constrained;
+
 // The filter deducer helps in selecting the filter type from the parameters
 // declared by the caller. The filter deducer also helps in passing through or
 // ignoring values for the filter construction. Finally the deducer helps in
@@ -64,13 +83,11 @@ template <typename Filter = void> struct filter_deducer {
   template <typename... Arguments>
   [[nodiscard]] static constexpr auto
   operator()([[maybe_unused]] Arguments... arguments)
-    requires(std::same_as<Filter, void>)
+    requires(std::same_as<Filter, void> && !(... || constraint<Arguments>))
   {
     static_assert(false,
                   "This requested filter configuration is not yet supported. "
                   "Please, submit a pull request or feature request.");
-
-    return x_z_p_r<double>{};
   }
 
   [[nodiscard]] static constexpr auto operator()() -> x_z_p_r<double>
@@ -161,6 +178,279 @@ template <typename Filter = void> struct filter_deducer {
               typename kt::observation_function(hh.value)};
   }
 
+  // The output model H and the state transition F are derived from the
+  // observation and transition functions by forward-mode automatic
+  // differentiation when the functions are generic over the scalar type. The
+  // translation unit includes the dual number header defining the
+  // differentiation, unless its linear algebra backend already does.
+  template <typename X, typename Z, typename P, typename Q, typename R,
+            typename T, typename O, typename... Us, typename... Ps>
+    requires requires() {
+      requires std::invocable<T, differentiable<X>, Ps...>;
+      requires std::invocable<O, differentiable<X>, Us...>;
+    }
+  [[nodiscard]] static constexpr auto
+  operator()(state<X> x, [[maybe_unused]] output_t<Z> z,
+             estimate_uncertainty<P> p, process_uncertainty<Q> q,
+             output_uncertainty<R> r, transition<T> ff, observation<O> hh,
+             [[maybe_unused]] update_types_t<Us...> uts,
+             [[maybe_unused]] prediction_types_t<Ps...> pts) {
+    using kt = x_z_p_q_r_hh_f_us_ps<X, Z, repack<update_types_t<Us...>>,
+                                    repack<prediction_types_t<Ps...>>>;
+
+    return kt{typename kt::state(x.value),
+              typename kt::estimate_uncertainty(p.value),
+              typename kt::process_uncertainty(q.value),
+              typename kt::output_uncertainty(r.value),
+              typename kt::observation_state_function(
+                  [observe = hh.value](const X &state_x,
+                                       const Us &...update_pack) {
+                    return jacobian<typename kt::output_model>(
+                        observe, state_x, update_pack...);
+                  }),
+              typename kt::transition_function(ff.value),
+              typename kt::observation_function(hh.value),
+              typename kt::iteration_parameters{},
+              typename kt::transition_state_function(
+                  [evolve = ff.value](const X &state_x,
+                                      const Ps &...prediction_pack) {
+                    return jacobian<typename kt::state_transition>(
+                        evolve, state_x, prediction_pack...);
+                  })};
+  }
+
+  template <typename X, typename Z, typename P, typename Q, typename R,
+            typename T, typename O>
+    requires requires() {
+      requires std::invocable<T, differentiable<X>>;
+      requires std::invocable<O, differentiable<X>>;
+    }
+  [[nodiscard]] static constexpr auto
+  operator()(state<X> x, output_t<Z> z, estimate_uncertainty<P> p,
+             process_uncertainty<Q> q, output_uncertainty<R> r,
+             transition<T> ff, observation<O> hh) {
+    return operator()(x, z, p, q, r, ff, hh, update_types<>,
+                      prediction_types<>);
+  }
+
+  // The iterated extended filter relinearizes the observation around the
+  // updated estimate.
+  template <typename X, typename Z, typename P, typename Q, typename R,
+            typename H, typename T, typename O, typename S, typename... Us,
+            typename... Ps>
+    requires requires() {
+      requires std::invocable<H, X, Us...>;
+      requires std::invocable<T, X, Ps...>;
+      requires std::invocable<O, X, Us...>;
+    }
+  [[nodiscard]] static constexpr auto
+  operator()(state<X> x, [[maybe_unused]] output_t<Z> z,
+             estimate_uncertainty<P> p, process_uncertainty<Q> q,
+             output_uncertainty<R> r, output_model<H> h, transition<T> ff,
+             observation<O> hh, iterations<S> settings,
+             [[maybe_unused]] update_types_t<Us...> uts,
+             [[maybe_unused]] prediction_types_t<Ps...> pts) {
+    using kt = x_z_p_q_r_hh_f_us_ps<X, Z, repack<update_types_t<Us...>>,
+                                    repack<prediction_types_t<Ps...>>>;
+
+    return kt{typename kt::state(x.value),
+              typename kt::estimate_uncertainty(p.value),
+              typename kt::process_uncertainty(q.value),
+              typename kt::output_uncertainty(r.value),
+              typename kt::observation_state_function(h.value),
+              typename kt::transition_function(ff.value),
+              typename kt::observation_function(hh.value),
+              typename kt::iteration_parameters{
+                  settings.count,
+                  static_cast<scalar_of<X>>(settings.tolerance)}};
+  }
+
+  template <typename X, typename Z, typename P, typename Q, typename R,
+            typename T, typename O, typename S, typename... Us,
+            typename... Ps>
+    requires requires() {
+      requires std::invocable<T, differentiable<X>, Ps...>;
+      requires std::invocable<O, differentiable<X>, Us...>;
+    }
+  [[nodiscard]] static constexpr auto
+  operator()(state<X> x, [[maybe_unused]] output_t<Z> z,
+             estimate_uncertainty<P> p, process_uncertainty<Q> q,
+             output_uncertainty<R> r, transition<T> ff, observation<O> hh,
+             iterations<S> settings,
+             [[maybe_unused]] update_types_t<Us...> uts,
+             [[maybe_unused]] prediction_types_t<Ps...> pts) {
+    using kt = x_z_p_q_r_hh_f_us_ps<X, Z, repack<update_types_t<Us...>>,
+                                    repack<prediction_types_t<Ps...>>>;
+
+    return kt{typename kt::state(x.value),
+              typename kt::estimate_uncertainty(p.value),
+              typename kt::process_uncertainty(q.value),
+              typename kt::output_uncertainty(r.value),
+              typename kt::observation_state_function(
+                  [observe = hh.value](const X &state_x,
+                                       const Us &...update_pack) {
+                    return jacobian<typename kt::output_model>(
+                        observe, state_x, update_pack...);
+                  }),
+              typename kt::transition_function(ff.value),
+              typename kt::observation_function(hh.value),
+              typename kt::iteration_parameters{
+                  settings.count,
+                  static_cast<scalar_of<X>>(settings.tolerance)},
+              typename kt::transition_state_function(
+                  [evolve = ff.value](const X &state_x,
+                                      const Ps &...prediction_pack) {
+                    return jacobian<typename kt::state_transition>(
+                        evolve, state_x, prediction_pack...);
+                  })};
+  }
+
+  template <typename X, typename Z, typename P, typename Q, typename R,
+            typename T, typename O, typename S>
+    requires requires() {
+      requires std::invocable<T, differentiable<X>>;
+      requires std::invocable<O, differentiable<X>>;
+    }
+  [[nodiscard]] static constexpr auto
+  operator()(state<X> x, output_t<Z> z, estimate_uncertainty<P> p,
+             process_uncertainty<Q> q, output_uncertainty<R> r,
+             transition<T> ff, observation<O> hh, iterations<S> settings) {
+    return operator()(x, z, p, q, r, ff, hh, settings, update_types<>,
+                      prediction_types<>);
+  }
+
+  template <typename X, typename Z, typename P, typename Q, typename R,
+            typename T, typename O, typename S, typename... Us,
+            typename... Ps>
+  [[nodiscard]] static constexpr auto
+  operator()(state<X> x, [[maybe_unused]] output_t<Z> z,
+             estimate_uncertainty<P> p, process_uncertainty<Q> q,
+             output_uncertainty<R> r, transition<T> ff, observation<O> hh,
+             sigma_points<S> points,
+             [[maybe_unused]] update_types_t<Us...> uts,
+             [[maybe_unused]] prediction_types_t<Ps...> pts) {
+    using kt = x_z_p_q_r_ff_hh_sp_us_ps<X, Z, sigma_points<S>,
+                                        repack<update_types_t<Us...>>,
+                                        repack<prediction_types_t<Ps...>>>;
+
+    return kt{typename kt::state(x.value),
+              typename kt::estimate_uncertainty(p.value),
+              typename kt::process_uncertainty(q.value),
+              typename kt::output_uncertainty(r.value),
+              kt::batch_transition(ff.value),
+              kt::batch_observation(hh.value),
+              typename kt::rule(points)};
+  }
+
+  template <typename X, typename Z, typename P, typename Q, typename R,
+            typename T, typename O, typename S>
+  [[nodiscard]] static constexpr auto
+  operator()(state<X> x, output_t<Z> z, estimate_uncertainty<P> p,
+             process_uncertainty<Q> q, output_uncertainty<R> r,
+             transition<T> ff, observation<O> hh, sigma_points<S> points) {
+    return operator()(x, z, p, q, r, ff, hh, points, update_types<>,
+                      prediction_types<>);
+  }
+
+  template <typename X, typename Z, typename P, typename Q, typename R,
+            typename T, typename O, typename S, typename... Us,
+            typename... Ps>
+  [[nodiscard]] static constexpr auto
+  operator()(state<X> x, [[maybe_unused]] output_t<Z> z,
+             estimate_uncertainty<P> p, process_uncertainty<Q> q,
+             output_uncertainty<R> r, transition<T> ff, observation<O> hh,
+             cubature_points_t<S> points,
+             [[maybe_unused]] update_types_t<Us...> uts,
+             [[maybe_unused]] prediction_types_t<Ps...> pts) {
+    using kt = x_z_p_q_r_ff_hh_sp_us_ps<X, Z, cubature_points_t<S>,
+                                        repack<update_types_t<Us...>>,
+                                        repack<prediction_types_t<Ps...>>>;
+
+    return kt{typename kt::state(x.value),
+              typename kt::estimate_uncertainty(p.value),
+              typename kt::process_uncertainty(q.value),
+              typename kt::output_uncertainty(r.value),
+              kt::batch_transition(ff.value),
+              kt::batch_observation(hh.value),
+              typename kt::rule(points)};
+  }
+
+  template <typename X, typename Z, typename P, typename Q, typename R,
+            typename T, typename O, typename S>
+  [[nodiscard]] static constexpr auto
+  operator()(state<X> x, output_t<Z> z, estimate_uncertainty<P> p,
+             process_uncertainty<Q> q, output_uncertainty<R> r,
+             transition<T> ff, observation<O> hh,
+             cubature_points_t<S> points) {
+    return operator()(x, z, p, q, r, ff, hh, points, update_types<>,
+                      prediction_types<>);
+  }
+
+  template <typename X, typename Z, typename P, typename Q, typename R,
+            typename T, typename O, typename S, std::size_t N, typename... Us,
+            typename... Ps>
+  [[nodiscard]] static constexpr auto
+  operator()(state<X> x, [[maybe_unused]] output_t<Z> z,
+             estimate_uncertainty<P> p, process_uncertainty<Q> q,
+             output_uncertainty<R> r, transition<T> ff, observation<O> hh,
+             ensemble_t<S, N> members,
+             [[maybe_unused]] update_types_t<Us...> uts,
+             [[maybe_unused]] prediction_types_t<Ps...> pts) {
+    using kt = x_z_p_q_r_ff_hh_en_us_ps<X, Z, ensemble_t<S, N>,
+                                        repack<update_types_t<Us...>>,
+                                        repack<prediction_types_t<Ps...>>>;
+
+    kt filter{.mean = typename kt::state(x.value),
+              .transition = typename kt::transition_function(ff.value),
+              .observation = typename kt::observation_function(hh.value),
+              .engine = typename kt::random_engine(members.seed)};
+    filter.q(typename kt::process_uncertainty(q.value));
+    filter.r(typename kt::output_uncertainty(r.value));
+    filter.p(typename kt::estimate_uncertainty(p.value));
+    return filter;
+  }
+
+  template <typename X, typename Z, typename P, typename Q, typename R,
+            typename T, typename O, typename S, std::size_t N>
+  [[nodiscard]] static constexpr auto
+  operator()(state<X> x, output_t<Z> z, estimate_uncertainty<P> p,
+             process_uncertainty<Q> q, output_uncertainty<R> r,
+             transition<T> ff, observation<O> hh, ensemble_t<S, N> members) {
+    return operator()(x, z, p, q, r, ff, hh, members, update_types<>,
+                      prediction_types<>);
+  }
+
+  template <typename X, typename Z, typename P, typename Q, typename R,
+            typename T, typename O, typename S, typename... Us, typename... Ps>
+  [[nodiscard]] static constexpr auto
+  operator()(state<X> x, [[maybe_unused]] output_t<Z> z,
+             estimate_uncertainty<P> p, process_uncertainty<Q> q,
+             output_uncertainty<R> r, transition<T> ff, observation<O> hh,
+             particles<S> settings, [[maybe_unused]] update_types_t<Us...> uts,
+             [[maybe_unused]] prediction_types_t<Ps...> pts) {
+    using kt = x_z_p_q_r_ff_hh_pa_us_ps<X, Z, particles<S>,
+                                        repack<update_types_t<Us...>>,
+                                        repack<prediction_types_t<Ps...>>>;
+
+    return kt{typename kt::state(x.value),
+              typename kt::estimate_uncertainty(p.value),
+              typename kt::process_uncertainty(q.value),
+              typename kt::output_uncertainty(r.value),
+              typename kt::transition_function(ff.value),
+              typename kt::observation_function(hh.value),
+              settings};
+  }
+
+  template <typename X, typename Z, typename P, typename Q, typename R,
+            typename T, typename O, typename S>
+  [[nodiscard]] static constexpr auto
+  operator()(state<X> x, output_t<Z> z, estimate_uncertainty<P> p,
+             process_uncertainty<Q> q, output_uncertainty<R> r,
+             transition<T> ff, observation<O> hh, particles<S> settings) {
+    return operator()(x, z, p, q, r, ff, hh, settings, update_types<>,
+                      prediction_types<>);
+  }
+
   template <typename X, typename Z, typename P, typename Q, typename R,
             typename H, typename F, typename O, typename... Ps>
     requires requires() {
@@ -185,6 +475,81 @@ template <typename Filter = void> struct filter_deducer {
               typename kt::observation_function(obs.value)};
   }
 
+  template <typename X, typename Z, typename P, typename Q, typename R,
+            typename H, typename F, typename... Ps>
+    requires requires() { requires std::invocable<F, Ps...>; }
+  [[nodiscard]] static constexpr auto
+  operator()(state<X> x, [[maybe_unused]] output_t<Z> z,
+             estimate_uncertainty<P> p, process_uncertainty<Q> q,
+             output_uncertainty<R> r, output_model<H> h,
+             state_transition<F> ff,
+             [[maybe_unused]] prediction_types_t<Ps...> pts) {
+    using kt = x_z_p_q_r_hh_ff_ps<X, Z, repack<prediction_types_t<Ps...>>>;
+
+    return kt{.x = typename kt::state(x.value),
+              .p = typename kt::estimate_uncertainty(p.value),
+              .q = typename kt::process_uncertainty(q.value),
+              .r = typename kt::output_uncertainty(r.value),
+              .transition_state_f =
+                  typename kt::transition_state_function(ff.value),
+              .h = typename kt::output_model(h.value)};
+  }
+
+  template <typename X, typename E, typename Z, typename P, typename Q,
+            typename R, typename H, typename F, typename T, typename O,
+            typename A, typename L, typename... Ps>
+    requires requires() {
+      requires std::invocable<H, X>;
+      requires std::invocable<F, X, Ps...>;
+      requires std::invocable<A, X, E>;
+      requires std::invocable<L, Z, Z>;
+    }
+  [[nodiscard]] static constexpr auto
+  operator()(state<X> x, [[maybe_unused]] error_state_t<E> e,
+             [[maybe_unused]] output_t<Z> z, estimate_uncertainty<P> p,
+             process_uncertainty<Q> q, output_uncertainty<R> r,
+             output_model<H> hh, state_transition<F> ff, transition<T> tt,
+             observation<O> oo, retraction<A> aa, local<L> ll,
+             [[maybe_unused]] prediction_types_t<Ps...> pts) {
+    using kt = x_z_p_q_r_hh_ff_es_ps<
+        X, E, Z, evaluate<std::invoke_result_t<L, const Z &, const Z &>>,
+        repack<prediction_types_t<Ps...>>>;
+
+    return kt{typename kt::state(x.value),
+              typename kt::estimate_uncertainty(p.value),
+              typename kt::process_uncertainty(q.value),
+              typename kt::output_uncertainty(r.value),
+              typename kt::observation_state_function(hh.value),
+              typename kt::transition_state_function(ff.value),
+              typename kt::observation_function(oo.value),
+              typename kt::transition_function(tt.value),
+              typename kt::retraction_function(aa.value),
+              typename kt::local_function(ll.value)};
+  }
+
+  template <typename X, typename E, typename Z, typename P, typename Q,
+            typename R, typename H, typename F, typename T, typename O,
+            typename A, typename... Ps>
+    requires requires() {
+      requires std::invocable<H, X>;
+      requires std::invocable<F, X, Ps...>;
+      requires std::invocable<A, X, E>;
+    }
+  [[nodiscard]] static constexpr auto
+  operator()(state<X> x, error_state_t<E> e, output_t<Z> z,
+             estimate_uncertainty<P> p, process_uncertainty<Q> q,
+             output_uncertainty<R> r, output_model<H> hh,
+             state_transition<F> ff, transition<T> tt, observation<O> oo,
+             retraction<A> aa, prediction_types_t<Ps...> pts) {
+    using innovation = evaluate<difference<Z, Z>>;
+
+    return operator()(x, e, z, p, q, r, hh, ff, tt, oo, aa,
+                      local{[](const Z &measured, const Z &expected) {
+                        return innovation{measured - expected};
+                      }},
+                      pts);
+  }
+
   template <typename X, typename Z, typename P, typename Q, typename R,
             typename H, typename F>
   [[nodiscard]] static constexpr auto
@@ -335,6 +700,68 @@ template <typename Filter = void> struct filter_deducer {
               typename kt::noise_observation_function(r.value),
               typename kt::state_transition(f.value)};
   }
+
+  template <typename X, typename P, typename Q, typename F, typename... Zs,
+            typename... Hs, typename... Rs, typename... Ns>
+    requires(sizeof...(Ns) > 0)
+  [[nodiscard]] static constexpr auto
+  operator()(state<X> x, estimate_uncertainty<P> p, process_uncertainty<Q> q,
+             state_transition<F> f, sensor<Zs, Hs, Rs, Ns>... sensors) {
+    using kt = x_z_p_q_r_h_f_ss<X, std::tuple<>, sensor<Zs, Hs, Rs, Ns>...>;
+
+    return kt{typename kt::state(x.value),
+              typename kt::estimate_uncertainty(p.value),
+              typename kt::process_uncertainty(q.value),
+              typename kt::state_transition(f.value),
+              typename kt::measurements(sensors...)};
+  }
+
+  template <typename X, typename P, typename Q, typename F, typename... Ps,
+            typename... Zs, typename... Hs, typename... Rs, typename... Ns>
+    requires(sizeof...(Ns) > 0)
+  [[nodiscard]] static constexpr auto
+  operator()(state<X> x, estimate_uncertainty<P> p, process_uncertainty<Q> q,
+             state_transition<F> f,
+             [[maybe_unused]] prediction_types_t<Ps...> pts,
+             sensor<Zs, Hs, Rs, Ns>... sensors) {
+    using kt = x_z_p_q_r_h_f_ss<X, repack<prediction_types_t<Ps...>>,
+                                sensor<Zs, Hs, Rs, Ns>...>;
+
+    return kt{.x = typename kt::state(x.value),
+              .p = typename kt::estimate_uncertainty(p.value),
+              .q = typename kt::process_uncertainty(q.value),
+              .models = typename kt::measurements(sensors...),
+              .transition_state_f =
+                  typename kt::transition_state_function(f.value)};
+  }
+
+  // The trailing constraints declarations constrain the filter deduced from the
+  // leading declarations.
+  template <typename... Arguments>
+    requires(... || constraint<Arguments>)
+  [[nodiscard]] static constexpr auto operator()(Arguments... arguments) {
+    constexpr std::size_t count{(std::size_t{0} + ... +
+                                 std::size_t{constraint<Arguments>})};
+    constexpr std::size_t leading{sizeof...(Arguments) - count};
+    const std::tuple<Arguments...> declarations{arguments...};
+
+    return [&]<std::size_t... Filters, std::size_t... Constraints>(
+               std::index_sequence<Filters...>,
+               std::index_sequence<Constraints...>) {
+      static_assert(
+          (... && constraint<std::tuple_element_t<leading + Constraints,
+                                                  std::tuple<Arguments...>>>),
+          "The constraints must be declared last.");
+
+      using kt = constrained<
+          decltype(filter_deducer<>{}(std::get<Filters>(declarations)...)),
+          std::tuple_element_t<leading + Constraints,
+                               std::tuple<Arguments...>>...>;
+
+      return kt{filter_deducer<>{}(std::get<Filters>(declarations)...),
+                std::get<leading + Constraints>(declarations)...};
+    }(std::make_index_sequence<leading>{}, std::make_index_sequence<count>{});
+  }
 };
 
 template <typename Filter> inline constexpr filter_deducer<Filter> deducer{};
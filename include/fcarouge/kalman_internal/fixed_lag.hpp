@@ -0,0 +1,192 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_INTERNAL_FIXED_LAG_HPP
+#define FCAROUGE_KALMAN_INTERNAL_FIXED_LAG_HPP
+
+#include "utility.hpp"
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace fcarouge::kalman_internal {
+//! @brief Fixed-lag smoother lag parameter.
+//!
+//! @details The `Size` number of steps between the smoothed estimate and the
+//! filtered estimate.
+template <std::size_t Size> struct lag_t {};
+
+template <std::size_t Size> inline lag_t<Size> lag{};
+
+//! @brief Fixed-lag smoother.
+//!
+//! @details Wraps a linear filter. Each prediction enters the estimate before
+//! the prediction in a ring buffer of the `Lag` last estimates, with the cross
+//! covariance of its error with the filter error. Each update of the filter
+//! also corrects the estimates in the ring buffer through their cross
+//! covariances. The oldest estimate of the ring buffer is the lag smoothed
+//! estimate `X[k-Lag|k]`. Each step costs a constant number of matrix products
+//! per estimate of the ring buffer. The steps do not allocate.
+//!
+//! @tparam Filter The type of the wrapped `kalman` filter. The filter must
+//! expose its state transition F, output model H, gain K, innovation Y, and
+//! innovation uncertainty S.
+//! @tparam Lag The number of lag steps.
+template <typename Filter, std::size_t Lag> class fixed_lag {
+public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief Type of the state estimate column vector X.
+  using state = Filter::state;
+
+  //! @brief Type of the estimated covariance matrix P.
+  using estimate_uncertainty = Filter::estimate_uncertainty;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs the smoother of a filter.
+  //!
+  //! @param filter The forward filter, copied.
+  //! @param steps The lag.
+  constexpr fixed_lag(const Filter &filter,
+                      [[maybe_unused]] lag_t<Lag> steps = {})
+      : filtering{filter} {
+    static_assert(Lag > 0, "The fixed-lag smoother requires a lag.");
+  }
+
+  //! @brief Returns the lag smoothed state estimate column vector X.
+  //!
+  //! @details The oldest estimate available during the first `Lag` steps.
+  [[nodiscard]] constexpr auto x() const -> const state & {
+    return count ? slots[head].x : filtering.x();
+  }
+
+  //! @brief Returns the lag smoothed estimated covariance matrix P.
+  [[nodiscard]] constexpr auto p() const -> const estimate_uncertainty & {
+    return count ? slots[head].p : filtering.p();
+  }
+
+  //! @brief Read, write the forward filter.
+  [[nodiscard]] constexpr auto filter(this auto &&self) -> decltype(auto) {
+    return (std::forward<decltype(self)>(self).filtering);
+  }
+
+  //! @brief Returns the number of estimates in the ring buffer.
+  [[nodiscard]] constexpr auto size() const -> std::size_t { return count; }
+
+  //! @brief Enters the estimate in the ring buffer and predicts the filter.
+  //!
+  //! @param arguments The prediction arguments forwarded to the filter.
+  //!
+  //! @complexity Linear in the lag.
+  constexpr void predict(const auto &...arguments) {
+    if (count == Lag) {
+      head = (head + 1) % Lag;
+    } else {
+      ++count;
+    }
+    slot &entered{slots[(head + count - 1) % Lag]};
+    entered.x = filtering.x();
+    entered.p = filtering.p();
+    entered.sigma = filtering.p();
+
+    filtering.predict(arguments...);
+
+    const auto &f{filtering.f()};
+    for (std::size_t index{0}; index < count; ++index) {
+      slot &entry{slots[(head + index) % Lag]};
+      entry.sigma = estimate_uncertainty{entry.sigma * t(f)};
+    }
+  }
+
+  //! @brief Updates the filter and the estimates in the ring buffer.
+  //!
+  //! @param arguments The update arguments forwarded to the filter.
+  //!
+  //! @complexity Linear in the lag.
+  constexpr void update(const auto &...arguments) {
+    filtering.update(arguments...);
+
+    const auto &h{filtering.h()};
+    const auto &k{filtering.k()};
+    const auto &y{filtering.y()};
+    const auto &s{filtering.s()};
+    for (std::size_t index{0}; index < count; ++index) {
+      slot &entry{slots[(head + index) % Lag]};
+      const auto gain{entry.sigma * t(h) / s};
+      entry.x = state{entry.x + gain * y};
+      entry.p = estimate_uncertainty{entry.p - gain * s * t(gain)};
+      entry.sigma =
+          estimate_uncertainty{entry.sigma - entry.sigma * t(h) * t(k)};
+    }
+  }
+
+  //! @}
+
+private:
+  //! @name Private Member Types
+  //! @{
+
+  // A smoothed estimate with the cross covariance of its error with the error
+  // of the filter estimate.
+  struct slot {
+    state x{zero<state>};
+    estimate_uncertainty p{zero<estimate_uncertainty>};
+    estimate_uncertainty sigma{zero<estimate_uncertainty>};
+  };
+
+  //! @}
+
+  //! @name Private Member Variables
+  //! @{
+
+  Filter filtering;
+  std::array<slot, Lag> slots{};
+  std::size_t head{0};
+  std::size_t count{0};
+
+  //! @}
+};
+} // namespace fcarouge::kalman_internal
+
+#endif // FCAROUGE_KALMAN_INTERNAL_FIXED_LAG_HPP
@@ -48,6 +48,8 @@ template <typename Undefined> class function;
 template <typename Result, typename... Arguments>
 class function<Result(Arguments...)> {
 public:
+  constexpr function() = default;
+
   template <typename Callable>
   constexpr explicit function(Callable callee)
       : storage{std::make_unique<implementation<Callable>>(callee)} {}
@@ -61,6 +63,10 @@ public:
     return (*storage)(arguments...);
   }
 
+  constexpr explicit operator bool() const {
+    return static_cast<bool>(storage);
+  }
+
 private:
   struct interface {
     constexpr virtual auto operator()(Arguments...) -> Result = 0;
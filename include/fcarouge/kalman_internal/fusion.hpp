@@ -0,0 +1,248 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_INTERNAL_FUSION_HPP
+#define FCAROUGE_KALMAN_INTERNAL_FUSION_HPP
+
+#include "utility.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <tuple>
+
+namespace fcarouge::kalman_internal {
+//! @brief Lock-free bounded single-producer single-consumer queue.
+//!
+//! @details One thread pushes, one other thread reads the front and pops. The
+//! values are stored in a fixed-size ring, the operations do not allocate nor
+//! block.
+template <typename Value, std::size_t Capacity> class ring_queue {
+public:
+  //! @brief Appends a value, unless the queue is full.
+  //!
+  //! @return False when the queue is full and the value is discarded.
+  constexpr auto push(const Value &value) -> bool {
+    const std::size_t back{tail.load(std::memory_order_relaxed)};
+    if (back - head.load(std::memory_order_acquire) == Capacity) {
+      return false;
+    }
+    values[back % Capacity] = value;
+    tail.store(back + 1, std::memory_order_release);
+    return true;
+  }
+
+  //! @brief Returns the oldest value, or null when the queue is empty.
+  [[nodiscard]] constexpr auto front() const -> const Value * {
+    const std::size_t front_index{head.load(std::memory_order_relaxed)};
+    if (front_index == tail.load(std::memory_order_acquire)) {
+      return nullptr;
+    }
+    return &values[front_index % Capacity];
+  }
+
+  //! @brief Removes the oldest value of a non-empty queue.
+  constexpr void pop() {
+    head.store(head.load(std::memory_order_relaxed) + 1,
+               std::memory_order_release);
+  }
+
+private:
+  std::array<Value, Capacity> values{};
+  alignas(64) std::atomic<std::size_t> head{0};
+  alignas(64) std::atomic<std::size_t> tail{0};
+};
+
+//! @brief Filter updatable with the measurements of a named sensor.
+//!
+//! @details The filter is declared with the named sensor and selects its
+//! measurement model on update.
+template <typename Filter, typename Sensor>
+concept fusible = requires(Filter filter, const typename Sensor::output &z) {
+  filter.template update<typename Sensor::name>(z);
+};
+
+//! @brief Multi-rate asynchronous sensor fusion front-end.
+//!
+//! @details Drives a filter declared with several named sensors from their
+//! timestamped measurements. Each sensor queue has its own lock-free queue,
+//! pushed by the thread of the sensor, typed with the output of the sensor.
+//! The processing thread merges the queues in timestamp order, like a priority
+//! queue. For each measurement, it predicts the filter to the measurement time
+//! with the elapsed time as prediction argument, then updates the filter with
+//! the named sensor of the queue. Measurements of a same time only predict
+//! once. Measurements older than the filter time are applied at the filter
+//! time. Process up to a time all the sensors reported, accounting for their
+//! latencies.
+//!
+//! @tparam Filter The type of the driven `kalman` filter, declared with named
+//! sensors. Its prediction takes the elapsed time `Time - Time` as argument.
+//! @tparam Time The type of the timestamps.
+//! @tparam Capacity The capacity of the queue of each sensor.
+//! @tparam Sensors The types of the named sensors declarations of the filter,
+//! one per queue. A sensor may have several queues.
+template <typename Filter, typename Time, std::size_t Capacity,
+          typename... Sensors>
+class fusion {
+public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief Type of the state estimate column vector X.
+  using state = Filter::state;
+
+  //! @brief Type of the estimated covariance matrix P.
+  using estimate_uncertainty = Filter::estimate_uncertainty;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs the front-end of a filter.
+  //!
+  //! @param filter The driven filter, referenced.
+  //! @param start The time of the filter estimate.
+  //! @param sensors The named sensors declarations of the filter, one per
+  //! queue.
+  constexpr fusion(Filter &filter, const Time &start,
+                   [[maybe_unused]] const Sensors &...sensors)
+      : filtering{filter}, now{start} {
+    static_assert((fusible<Filter, Sensors> && ...),
+                  "The filter must be declared with the named sensors.");
+  }
+
+  //! @brief Returns the time of the filter estimate.
+  [[nodiscard]] constexpr auto time() const -> const Time & { return now; }
+
+  //! @brief Queues a measurement of the `Sensor` index position.
+  //!
+  //! @details Lock-free. Called from at most one thread per sensor queue.
+  //!
+  //! @param time The timestamp of the measurement.
+  //! @param output_z The measurement elements, of the output of the sensor.
+  //!
+  //! @return False when the queue of the sensor is full and the measurement is
+  //! discarded.
+  template <std::size_t Sensor>
+  constexpr auto push(const Time &time, const auto &...output_z) -> bool {
+    using sensor_output =
+        std::tuple_element_t<Sensor, std::tuple<Sensors...>>::output;
+    return std::get<Sensor>(channels).queue.push(
+        {time, sensor_output{output_z...}});
+  }
+
+  //! @brief Processes the queued measurements up to the time, in timestamp
+  //! order.
+  //!
+  //! @details Called from one thread.
+  //!
+  //! @return The number of processed measurements.
+  constexpr auto process(const Time &until) -> std::size_t {
+    std::size_t processed{0};
+
+    while (true) {
+      std::size_t earliest{sizeof...(Sensors)};
+      Time earliest_time{until};
+      for_constexpr<0, sizeof...(Sensors), 1>([&](auto index) {
+        if (const auto *measurement{std::get<index>(channels).queue.front()};
+            measurement && !(earliest_time < measurement->time) &&
+            (earliest == sizeof...(Sensors) ||
+             measurement->time < earliest_time)) {
+          earliest = index;
+          earliest_time = measurement->time;
+        }
+      });
+
+      if (earliest == sizeof...(Sensors)) {
+        return processed;
+      }
+
+      if (now < earliest_time) {
+        filtering.predict(earliest_time - now);
+        now = earliest_time;
+      }
+
+      for_constexpr<0, sizeof...(Sensors), 1>([this, earliest](auto index) {
+        if (index == earliest) {
+          using declared = std::tuple_element_t<index, std::tuple<Sensors...>>;
+          auto &selected{std::get<index>(channels)};
+          filtering.template update<typename declared::name>(
+              selected.queue.front()->z);
+          selected.queue.pop();
+        }
+      });
+      ++processed;
+    }
+  }
+
+  //! @}
+
+private:
+  //! @name Private Member Types
+  //! @{
+
+  // The measurements queue of a sensor, typed with the output of the sensor.
+  template <typename Sensor> struct channel {
+    using output = Sensor::output;
+
+    struct measurement {
+      Time time{};
+      output z{zero<output>};
+    };
+
+    ring_queue<measurement, Capacity> queue{};
+  };
+
+  //! @}
+
+  //! @name Private Member Variables
+  //! @{
+
+  Filter &filtering;
+  Time now;
+  std::tuple<channel<Sensors>...> channels{};
+
+  //! @}
+};
+
+template <typename Filter, typename Time, typename... Sensors>
+fusion(Filter &, Time, Sensors...) -> fusion<Filter, Time, 1024, Sensors...>;
+} // namespace fcarouge::kalman_internal
+
+#endif // FCAROUGE_KALMAN_INTERNAL_FUSION_HPP
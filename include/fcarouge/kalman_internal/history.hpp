@@ -0,0 +1,83 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_INTERNAL_HISTORY_HPP
+#define FCAROUGE_KALMAN_INTERNAL_HISTORY_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace fcarouge::kalman_internal {
+//! @brief In memory history of records.
+//!
+//! @details The records are stored contiguously in the order of their
+//! recording.
+//!
+//! @tparam Record The type of the recorded values.
+template <typename Record> class memory_history {
+public:
+  //! @brief Constructs an empty history.
+  //!
+  //! @param capacity The number of records to reserve storage for.
+  constexpr explicit memory_history(std::size_t capacity = 0) {
+    records.reserve(capacity);
+  }
+
+  //! @brief Appends a record.
+  constexpr void push(const Record &record) { records.push_back(record); }
+
+  //! @brief Returns the record at the index position.
+  [[nodiscard]] constexpr auto operator[](std::size_t index) const
+      -> const Record & {
+    return records[index];
+  }
+
+  //! @brief Returns the number of records.
+  [[nodiscard]] constexpr auto size() const -> std::size_t {
+    return records.size();
+  }
+
+  //! @brief Removes all the records.
+  constexpr void clear() { records.clear(); }
+
+private:
+  std::vector<Record> records;
+};
+} // namespace fcarouge::kalman_internal
+
+#endif // FCAROUGE_KALMAN_INTERNAL_HISTORY_HPP
@@ -0,0 +1,311 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_INTERNAL_IMM_HPP
+#define FCAROUGE_KALMAN_INTERNAL_IMM_HPP
+
+#include "parallel.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace fcarouge::kalman_internal {
+//! @brief Interacting multiple model (IMM) estimator.
+//!
+//! @details Runs a bank of filters of the same state type in lockstep, one per
+//! mode of a maneuvering system, for example constant velocity and constant
+//! acceleration. The modes switch according to a Markov chain of transition
+//! probabilities `π`. Each prediction first mixes the model-conditioned
+//! estimates by their mixing probabilities. Each update weights the modes
+//! probabilities `μ` by the likelihood of the innovation of their filter. The
+//! estimate is the combination of the model-conditioned estimates. The filters
+//! of a large bank predict and update concurrently, those of a small bank
+//! sequentially: waking the threads would cost more than their steps. The
+//! mixing uses preallocated buffers.
+//!
+//! @tparam Filters The `kalman` filters of the modes. The filters must share
+//! the same state and estimate uncertainty types, and expose their innovation
+//! and innovation uncertainty.
+//!
+//! @todo Support filters with different states through a projection?
+template <typename... Filters> class imm {
+public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief Type of the state estimate column vector X.
+  using state = first<Filters...>::state;
+
+  //! @brief Type of the estimated covariance matrix P.
+  using estimate_uncertainty = first<Filters...>::estimate_uncertainty;
+
+  //! @brief Type of the probabilities.
+  using probability = std::remove_cvref_t<decltype(element(
+      std::declval<state &>(), std::size_t{0}))>;
+
+  //! @brief Number of modes.
+  static constexpr std::size_t size{sizeof...(Filters)};
+
+  //! @brief Type of the mode probabilities μ.
+  using probabilities = std::array<probability, size>;
+
+  //! @brief Type of the mode transition probabilities matrix π.
+  //!
+  //! @details The `[i][j]` element is the probability to switch from the mode
+  //! `i` to the mode `j`. The rows sum to one.
+  using transition_probabilities = std::array<probabilities, size>;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs the estimator from its filters.
+  //!
+  //! @details The modes are initially equiprobable and never switch.
+  //!
+  //! @param modes The filters of the modes, copied.
+  constexpr explicit imm(const Filters &...modes) : filters{modes...} {
+    static_assert(
+        (std::is_same_v<typename Filters::state, state> && ...),
+        "The filters of an interacting multiple model must share their state.");
+    mode_probabilities.fill(probability{1} / static_cast<probability>(size));
+    for (std::size_t i{0}; i < size; ++i) {
+      mode_transitions[i].fill(probability{0});
+      mode_transitions[i][i] = probability{1};
+    }
+    combine();
+  }
+
+  //! @brief Returns the combined state estimate column vector X.
+  [[nodiscard]] constexpr auto x() const -> const state & { return combined_x; }
+
+  //! @brief Returns the combined estimated covariance matrix P.
+  [[nodiscard]] constexpr auto p() const -> const estimate_uncertainty & {
+    return combined_p;
+  }
+
+  //! @brief Read, write the mode probabilities μ.
+  [[nodiscard]] constexpr auto mu(this auto &&self) -> decltype(auto) {
+    return (std::forward<decltype(self)>(self).mode_probabilities);
+  }
+
+  //! @brief Read, write the mode transition probabilities matrix π.
+  [[nodiscard]] constexpr auto pi(this auto &&self) -> decltype(auto) {
+    return (std::forward<decltype(self)>(self).mode_transitions);
+  }
+
+  //! @brief Read, write the filter of the mode at the `Mode` index.
+  template <std::size_t Mode>
+  [[nodiscard]] constexpr auto filter(this auto &&self) -> decltype(auto) {
+    return std::get<Mode>(std::forward<decltype(self)>(self).filters);
+  }
+
+  //! @brief Mixes the modes and predicts their filters.
+  //!
+  //! @param arguments The prediction arguments forwarded to each filter.
+  //!
+  //! @complexity Quadratic in the number of modes.
+  constexpr void predict(const auto &...arguments) {
+    mix();
+    on_filters([&arguments...]([[maybe_unused]] std::size_t index,
+                               auto &mode) { mode.predict(arguments...); });
+    combine();
+  }
+
+  //! @brief Updates the filters of the modes and their probabilities.
+  //!
+  //! @param arguments The update arguments forwarded to each filter.
+  constexpr void update(const auto &...arguments) {
+    on_filters([this, &arguments...](std::size_t index, auto &mode) {
+      mode.update(arguments...);
+      log_likelihoods[index] = log_likelihood(mode.y(), mode.s());
+    });
+
+    const probability maximum{std::ranges::max(log_likelihoods)};
+    probability total{0};
+    for (std::size_t j{0}; j < size; ++j) {
+      mode_probabilities[j] *= std::exp(log_likelihoods[j] - maximum);
+      total += mode_probabilities[j];
+    }
+    for (probability &mode_probability : mode_probabilities) {
+      mode_probability /= total;
+    }
+
+    combine();
+  }
+
+  //! @}
+
+private:
+  //! @name Private Member Functions
+  //! @{
+
+  // Invokes the function with the index and the filter of each mode. The
+  // number of modes times the cubed state dimension estimates the work of a
+  // step.
+  constexpr void on_filters(auto &&function) {
+    if constexpr (size * dimension<state> * dimension<state> *
+                      dimension<state> <
+                  concurrent_work) {
+      for_constexpr<0, size, 1>([this, &function](auto mode) {
+        function(std::size_t{mode}, std::get<mode>(filters));
+      });
+    } else {
+      for_parallel(size, [this, &function](std::size_t index) {
+        on_filter(index, [index, &function](auto &mode) {
+          function(index, mode);
+        });
+      });
+    }
+  }
+
+  // Invokes the function on the filter of the mode at the runtime index.
+  constexpr void on_filter(std::size_t index, auto &&function) {
+    for_constexpr<0, size, 1>([this, index, &function](auto mode) {
+      if (mode == index) {
+        function(std::get<mode>(filters));
+      }
+    });
+  }
+
+  // The logarithm of the Gaussian density of the innovation.
+  [[nodiscard]] static constexpr auto log_likelihood(const auto &y,
+                                                     const auto &s)
+      -> probability {
+    using innovation = std::remove_cvref_t<decltype(y)>;
+    using distance =
+        evaluate<product<evaluate<transpose<innovation>>, innovation>>;
+
+    distance squared{t(y) / s * y};
+    const probability dimensions{
+        static_cast<probability>(dimension<innovation>)};
+    return -(element(squared, 0) + std::log(determinant(s)) +
+             dimensions * std::log(2 * std::numbers::pi_v<probability>)) /
+           2;
+  }
+
+  // Mixes the model-conditioned estimates into the initial conditions of each
+  // filter. The mixing probability `μ[i|j]` of the mode `i` given the mode `j`
+  // is proportional to `π[i][j] * μ[i]`. The mode probabilities become the
+  // predicted mode probabilities.
+  constexpr void mix() {
+    for (std::size_t j{0}; j < size; ++j) {
+      predicted[j] = probability{0};
+      for (std::size_t i{0}; i < size; ++i) {
+        predicted[j] += mode_transitions[i][j] * mode_probabilities[i];
+      }
+      for (std::size_t i{0}; i < size; ++i) {
+        mixing[i][j] = predicted[j] > probability{0}
+                           ? mode_transitions[i][j] * mode_probabilities[i] /
+                                 predicted[j]
+                           : probability{0};
+      }
+    }
+    mode_probabilities = predicted;
+
+    for (std::size_t j{0}; j < size; ++j) {
+      mixed_x[j] = zero<state>;
+      for_constexpr<0, size, 1>([this, j](auto i) {
+        mixed_x[j] =
+            state{mixed_x[j] + mixing[i][j] * std::get<i>(filters).x()};
+      });
+      mixed_p[j] = zero<estimate_uncertainty>;
+      for_constexpr<0, size, 1>([this, j](auto i) {
+        const state dx{std::get<i>(filters).x() - mixed_x[j]};
+        mixed_p[j] = estimate_uncertainty{
+            mixed_p[j] +
+            mixing[i][j] * (std::get<i>(filters).p() + dx * t(dx))};
+      });
+    }
+
+    for_constexpr<0, size, 1>([this](auto j) {
+      std::get<j>(filters).x(mixed_x[j]);
+      std::get<j>(filters).p(mixed_p[j]);
+    });
+  }
+
+  // Combines the model-conditioned estimates weighted by the mode
+  // probabilities.
+  constexpr void combine() {
+    combined_x = zero<state>;
+    for_constexpr<0, size, 1>([this](auto j) {
+      combined_x = state{combined_x +
+                         mode_probabilities[j] * std::get<j>(filters).x()};
+    });
+    combined_p = zero<estimate_uncertainty>;
+    for_constexpr<0, size, 1>([this](auto j) {
+      const state dx{std::get<j>(filters).x() - combined_x};
+      combined_p = estimate_uncertainty{
+          combined_p +
+          mode_probabilities[j] * (std::get<j>(filters).p() + dx * t(dx))};
+    });
+  }
+
+  //! @}
+
+  //! @name Private Member Variables
+  //! @{
+
+  // The estimated work of a step from which the filters run concurrently, for
+  // example eight modes of eight states.
+  static constexpr std::size_t concurrent_work{4096};
+
+  std::tuple<Filters...> filters;
+  probabilities mode_probabilities{};
+  transition_probabilities mode_transitions{};
+  transition_probabilities mixing{};
+  probabilities predicted{};
+  probabilities log_likelihoods{};
+  std::array<state, size> mixed_x{};
+  std::array<estimate_uncertainty, size> mixed_p{};
+  state combined_x{zero<state>};
+  estimate_uncertainty combined_p{zero<estimate_uncertainty>};
+
+  //! @}
+};
+} // namespace fcarouge::kalman_internal
+
+#endif // FCAROUGE_KALMAN_INTERNAL_IMM_HPP
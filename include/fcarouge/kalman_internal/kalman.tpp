@@ -54,11 +54,18 @@ constexpr decltype(auto) kalman<Filter>::x(this auto &&self,
                                            const auto &...values)
   requires(kalman_internal::has_state<Filter>)
 {
-  if constexpr (sizeof...(values)) {
-    self.filter.x = typename Filter::state{values...};
+  if constexpr (kalman_internal::has_state_method<Filter>) {
+    if constexpr (sizeof...(values)) {
+      self.filter.x(typename Filter::state{values...});
+    }
+    return std::forward<decltype(self)>(self).filter.x();
+  } else {
+    if constexpr (sizeof...(values)) {
+      self.filter.x = typename Filter::state{values...};
+    }
+    //! @todo A conditional no_discard woud be nice here.
+    return std::forward<decltype(self)>(self).filter.x;
   }
-  //! @todo A conditional no_discard woud be nice here.
-  return std::forward<decltype(self)>(self).filter.x;
 }
 
 template <typename Filter>
@@ -88,10 +95,17 @@ constexpr decltype(auto) kalman<Filter>::p(this auto &&self,
                                            const auto &...values)
   requires(kalman_internal::has_estimate_uncertainty<Filter>)
 {
-  if constexpr (sizeof...(values)) {
-    self.filter.p = typename Filter::estimate_uncertainty{values...};
+  if constexpr (kalman_internal::has_estimate_uncertainty_method<Filter>) {
+    if constexpr (sizeof...(values)) {
+      self.filter.p(typename Filter::estimate_uncertainty{values...});
+    }
+    return std::forward<decltype(self)>(self).filter.p();
+  } else {
+    if constexpr (sizeof...(values)) {
+      self.filter.p = typename Filter::estimate_uncertainty{values...};
+    }
+    return std::forward<decltype(self)>(self).filter.p;
   }
-  return std::forward<decltype(self)>(self).filter.p;
 }
 
 template <typename Filter>
@@ -99,16 +113,24 @@ constexpr decltype(auto) kalman<Filter>::q(this auto &&self,
                                            const auto &...values)
   requires(kalman_internal::has_process_uncertainty<Filter>)
 {
-  if constexpr (sizeof...(values)) {
-    if constexpr (std::is_convertible_v<decltype(values)...,
-                                        typename Filter::process_uncertainty>) {
-      self.filter.q = typename Filter::process_uncertainty{values...};
-    } else {
-      using noise_process_function = decltype(filter.noise_process_q);
-      self.filter.noise_process_q = noise_process_function{values...};
+  if constexpr (kalman_internal::has_process_uncertainty_method<Filter>) {
+    if constexpr (sizeof...(values)) {
+      self.filter.q(typename Filter::process_uncertainty{values...});
     }
+    return std::forward<decltype(self)>(self).filter.q();
+  } else {
+    if constexpr (sizeof...(values)) {
+      if constexpr (std::is_convertible_v<
+                        decltype(values)...,
+                        typename Filter::process_uncertainty>) {
+        self.filter.q = typename Filter::process_uncertainty{values...};
+      } else {
+        using noise_process_function = decltype(filter.noise_process_q);
+        self.filter.noise_process_q = noise_process_function{values...};
+      }
+    }
+    return std::forward<decltype(self)>(self).filter.q;
   }
-  return std::forward<decltype(self)>(self).filter.q;
 }
 
 template <typename Filter>
@@ -116,16 +138,25 @@ constexpr decltype(auto) kalman<Filter>::r(this auto &&self,
                                            const auto &...values)
   requires(kalman_internal::has_output_uncertainty<Filter>)
 {
-  if constexpr (sizeof...(values)) {
-    if constexpr (std::is_convertible_v<decltype(values)...,
-                                        typename Filter::output_uncertainty>) {
-      self.filter.r = typename Filter::output_uncertainty{values...};
-    } else {
-      using noise_observation_function = decltype(filter.noise_observation_r);
-      self.filter.noise_observation_r = noise_observation_function{values...};
+  if constexpr (kalman_internal::has_output_uncertainty_method<Filter>) {
+    if constexpr (sizeof...(values)) {
+      self.filter.r(typename Filter::output_uncertainty{values...});
+    }
+    return std::forward<decltype(self)>(self).filter.r();
+  } else {
+    if constexpr (sizeof...(values)) {
+      if constexpr (std::is_convertible_v<
+                        decltype(values)...,
+                        typename Filter::output_uncertainty>) {
+        self.filter.r = typename Filter::output_uncertainty{values...};
+      } else {
+        using noise_observation_function =
+            decltype(filter.noise_observation_r);
+        self.filter.noise_observation_r = noise_observation_function{values...};
+      }
     }
+    return std::forward<decltype(self)>(self).filter.r;
   }
-  return std::forward<decltype(self)>(self).filter.r;
 }
 
 template <typename Filter>
@@ -230,6 +261,12 @@ constexpr void kalman<Filter>::update(const auto &...arguments) {
   filter.update(arguments...);
 }
 
+template <typename Filter>
+template <typename Name>
+constexpr void kalman<Filter>::update(const auto &...arguments) {
+  filter.template update<Name>(arguments...);
+}
+
 template <typename InternalFilter>
 template <auto Position>
 [[nodiscard("The returned update argument is unexpectedly "
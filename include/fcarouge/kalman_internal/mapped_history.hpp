@@ -0,0 +1,153 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_INTERNAL_MAPPED_HISTORY_HPP
+#define FCAROUGE_KALMAN_INTERNAL_MAPPED_HISTORY_HPP
+
+#if __has_include(<sys/mman.h>)
+
+#include <cerrno>
+#include <cstddef>
+#include <fcntl.h>
+#include <memory>
+#include <string>
+#include <sys/mman.h>
+#include <system_error>
+#include <unistd.h>
+
+namespace fcarouge::kalman_internal {
+//! @brief Memory-mapped file history of records.
+//!
+//! @details The records are stored contiguously in the order of their
+//! recording, in a file mapped to memory. The operating system pages the
+//! records in and out of memory, allowing for histories larger than the
+//! memory. The file doubles in size when full. The records must be bytewise
+//! relocatable, as are statically sized matrices. The file is left in place
+//! for inspection after destruction. Only available on POSIX systems.
+//!
+//! @tparam Record The type of the recorded values.
+//!
+//! @todo Support reopening an existing history file?
+template <typename Record> class mapped_history {
+public:
+  //! @brief Constructs an empty history backed by a file.
+  //!
+  //! @param path The path of the file, created or truncated.
+  //! @param initial_capacity The initial number of records of the file.
+  //!
+  //! @exception std::system_error The file cannot be created or mapped.
+  explicit mapped_history(const std::string &path,
+                          std::size_t initial_capacity = 1024)
+      : descriptor{::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644)} {
+    if (descriptor < 0) {
+      throw std::system_error{errno, std::generic_category(),
+                              "Cannot open the history file."};
+    }
+    try {
+      reserve(initial_capacity > 0 ? initial_capacity : 1);
+    } catch (...) {
+      ::close(descriptor);
+      throw;
+    }
+  }
+
+  mapped_history(const mapped_history &other) = delete;
+  auto operator=(const mapped_history &other) -> mapped_history & = delete;
+
+  //! @brief Unmaps and closes the file.
+  ~mapped_history() {
+    std::destroy_n(records, count);
+    ::munmap(records, capacity * sizeof(Record));
+    ::close(descriptor);
+  }
+
+  //! @brief Appends a record.
+  //!
+  //! @exception std::system_error The file cannot be grown.
+  void push(const Record &record) {
+    if (count == capacity) {
+      reserve(2 * capacity);
+    }
+    std::construct_at(records + count, record);
+    ++count;
+  }
+
+  //! @brief Returns the record at the index position.
+  [[nodiscard]] auto operator[](std::size_t index) const -> const Record & {
+    return records[index];
+  }
+
+  //! @brief Returns the number of records.
+  [[nodiscard]] auto size() const -> std::size_t { return count; }
+
+  //! @brief Removes all the records.
+  void clear() {
+    std::destroy_n(records, count);
+    count = 0;
+  }
+
+private:
+  void reserve(std::size_t records_capacity) {
+    const std::size_t bytes{records_capacity * sizeof(Record)};
+    if (::ftruncate(descriptor, static_cast<off_t>(bytes)) != 0) {
+      throw std::system_error{errno, std::generic_category(),
+                              "Cannot grow the history file."};
+    }
+    void *mapping{::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED,
+                         descriptor, 0)};
+    if (mapping == MAP_FAILED) {
+      throw std::system_error{errno, std::generic_category(),
+                              "Cannot map the history file."};
+    }
+    if (records) {
+      ::munmap(records, capacity * sizeof(Record));
+    }
+    records = static_cast<Record *>(mapping);
+    capacity = records_capacity;
+  }
+
+  int descriptor{-1};
+  Record *records{nullptr};
+  std::size_t capacity{0};
+  std::size_t count{0};
+};
+} // namespace fcarouge::kalman_internal
+
+#endif
+
+#endif // FCAROUGE_KALMAN_INTERNAL_MAPPED_HISTORY_HPP
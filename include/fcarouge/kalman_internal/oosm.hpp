@@ -0,0 +1,333 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_INTERNAL_OOSM_HPP
+#define FCAROUGE_KALMAN_INTERNAL_OOSM_HPP
+
+#include "utility.hpp"
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace fcarouge::kalman_internal {
+//! @brief Out-of-sequence measurement history parameter.
+//!
+//! @details The `Size` number of recorded events, predictions and updates,
+//! available for rollback.
+template <std::size_t Size> struct horizon_t {};
+
+template <std::size_t Size> inline horizon_t<Size> horizon{};
+
+template <typename Filter> struct prediction_pack {
+  using type = std::tuple<>;
+};
+
+template <typename Filter>
+  requires requires { typename Filter::prediction_types; }
+struct prediction_pack<Filter> {
+  using type = Filter::prediction_types;
+};
+
+template <typename Filter> struct update_pack {
+  using type = std::tuple<>;
+};
+
+template <typename Filter>
+  requires requires { typename Filter::update_types; }
+struct update_pack<Filter> {
+  using type = Filter::update_types;
+};
+
+struct no_input {};
+
+template <typename Filter> struct input_pack {
+  using type = no_input;
+};
+
+template <typename Filter>
+  requires requires { typename Filter::input; }
+struct input_pack<Filter> {
+  using type = Filter::input;
+};
+
+//! @brief Out-of-sequence measurement (OOSM) filter.
+//!
+//! @details Wraps a filter with a bounded, time-indexed history of its events.
+//! An event is a prediction with its prediction and input arguments, or an
+//! update with its update arguments and output. Each event records a snapshot
+//! of the estimate X and its uncertainty P after the event, not a copy of the
+//! filter. A late update rolls the filter back to the snapshot of the last
+//! event at or before its time, applies the measurement, and replays the
+//! subsequent events. The result is the result of the in-sequence filtering.
+//! The oldest event is forgotten when the history is full.
+//!
+//! @tparam Filter The type of the wrapped `kalman` filter.
+//! @tparam Horizon The number of events of the history.
+//! @tparam Time The type of the timestamps.
+//!
+//! @todo Support the one-step retrodiction (Bar-Shalom A1) of measurements
+//! older than the history for models providing their backward transition?
+template <typename Filter, std::size_t Horizon, typename Time = double>
+class oosm {
+public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief Type of the state estimate column vector X.
+  using state = Filter::state;
+
+  //! @brief Type of the estimated covariance matrix P.
+  using estimate_uncertainty = Filter::estimate_uncertainty;
+
+  //! @brief Type of the observation column vector Z.
+  using output = Filter::output;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs the out-of-sequence filter of a filter.
+  //!
+  //! @param filter The filter, copied.
+  //! @param length The number of events of the history.
+  constexpr oosm(const Filter &filter,
+                 [[maybe_unused]] horizon_t<Horizon> length = {})
+      : filtering{filter} {
+    static_assert(Horizon > 0,
+                  "The out-of-sequence filter requires a history.");
+  }
+
+  //! @brief Returns the state estimate column vector X.
+  [[nodiscard]] constexpr auto x() const -> decltype(auto) {
+    return filtering.x();
+  }
+
+  //! @brief Returns the estimated covariance matrix P.
+  [[nodiscard]] constexpr auto p() const -> decltype(auto) {
+    return filtering.p();
+  }
+
+  //! @brief Read, write the wrapped filter.
+  [[nodiscard]] constexpr auto filter(this auto &&self) -> decltype(auto) {
+    return (std::forward<decltype(self)>(self).filtering);
+  }
+
+  //! @brief Returns the number of recorded events.
+  [[nodiscard]] constexpr auto size() const -> std::size_t { return count; }
+
+  //! @brief Predicts the filter to the time.
+  //!
+  //! @param time The timestamp of the prediction, not older than the previous
+  //! events.
+  //! @param arguments The prediction arguments forwarded to the filter.
+  constexpr void predict(const Time &time, const auto &...arguments) {
+    filtering.predict(arguments...);
+    record(count, time, false);
+  }
+
+  //! @brief Updates the filter with a measurement of the time.
+  //!
+  //! @details Rolls back and replays the events younger than the measurement
+  //! time.
+  //!
+  //! @param time The timestamp of the measurement.
+  //! @param arguments The update arguments forwarded to the filter.
+  //!
+  //! @return False when the measurement is older than the history and is
+  //! discarded, true otherwise.
+  //!
+  //! @complexity Linear in the number of replayed events.
+  constexpr auto update(const Time &time, const auto &...arguments) -> bool {
+    std::size_t position{count};
+    while (position > 0 && time < at(position - 1).time) {
+      --position;
+    }
+
+    if (position == count) {
+      filtering.update(arguments...);
+      record(count, time, true);
+      return true;
+    }
+
+    if (position == 0) {
+      return false;
+    }
+
+    const event &previous{at(position - 1)};
+    filtering.x(previous.x);
+    filtering.p(previous.p);
+    filtering.update(arguments...);
+    position = insert(position);
+    record(position, time, true);
+
+    for (std::size_t index{position + 1}; index < count; ++index) {
+      replay(at(index));
+    }
+
+    return true;
+  }
+
+  //! @}
+
+private:
+  //! @name Private Member Types
+  //! @{
+
+  using prediction_arguments = prediction_pack<Filter>::type;
+  using update_arguments = update_pack<Filter>::type;
+  using input = input_pack<Filter>::type;
+
+  // A recorded prediction or update with the snapshot of the estimate after
+  // the event.
+  struct event {
+    Time time{};
+    bool measurement{false};
+    prediction_arguments predicted{};
+    input u{};
+    update_arguments updated{};
+    output z{zero<output>};
+    state x{zero<state>};
+    estimate_uncertainty p{zero<estimate_uncertainty>};
+  };
+
+  //! @}
+
+  //! @name Private Member Functions
+  //! @{
+
+  [[nodiscard]] constexpr auto at(std::size_t index) -> event & {
+    return events[(head + index) % Horizon];
+  }
+
+  // Makes room for an event at the position, forgetting the oldest event of a
+  // full history. Returns the position of the room.
+  constexpr auto insert(std::size_t position) -> std::size_t {
+    if (count == Horizon) {
+      head = (head + 1) % Horizon;
+      --count;
+      --position;
+    }
+    for (std::size_t index{count}; index > position; --index) {
+      at(index) = at(index - 1);
+    }
+    ++count;
+    return position;
+  }
+
+  // Records the last event of the filter at the position.
+  constexpr void record(std::size_t position, const Time &time,
+                        bool measurement) {
+    if (position == count) {
+      position = insert(position);
+    }
+
+    event &entry{at(position)};
+    entry.time = time;
+    entry.measurement = measurement;
+    if (measurement) {
+      entry.updated = arguments<update_arguments>(
+          [this]<std::size_t Index>() {
+            return filtering.template update<Index>();
+          });
+      entry.z = filtering.z();
+    } else {
+      entry.predicted = arguments<prediction_arguments>(
+          [this]<std::size_t Index>() {
+            return filtering.template predict<Index>();
+          });
+      if constexpr (!std::is_same_v<input, no_input>) {
+        entry.u = filtering.u();
+      }
+    }
+    entry.x = filtering.x();
+    entry.p = filtering.p();
+  }
+
+  // Replays the event on the filter and refreshes its snapshot.
+  constexpr void replay(event &entry) {
+    if (entry.measurement) {
+      std::apply(
+          [this, &entry](const auto &...updates) {
+            filtering.update(updates..., entry.z);
+          },
+          entry.updated);
+    } else {
+      std::apply(
+          [this, &entry](const auto &...predictions) {
+            if constexpr (std::is_same_v<input, no_input>) {
+              filtering.predict(predictions...);
+            } else {
+              filtering.predict(predictions..., entry.u);
+            }
+          },
+          entry.predicted);
+    }
+    entry.x = filtering.x();
+    entry.p = filtering.p();
+  }
+
+  // Collects the last arguments of the filter into their tuple.
+  template <typename Tuple>
+  [[nodiscard]] static constexpr auto arguments(auto &&get) -> Tuple {
+    return [&get]<std::size_t... Indexes>(std::index_sequence<Indexes...>) {
+      return Tuple{get.template operator()<Indexes>()...};
+    }(std::make_index_sequence<std::tuple_size_v<Tuple>>{});
+  }
+
+  //! @}
+
+  //! @name Private Member Variables
+  //! @{
+
+  Filter filtering;
+  std::array<event, Horizon> events{};
+  std::size_t head{0};
+  std::size_t count{0};
+
+  //! @}
+};
+
+template <typename Filter, std::size_t Horizon>
+oosm(Filter, horizon_t<Horizon>) -> oosm<Filter, Horizon>;
+} // namespace fcarouge::kalman_internal
+
+#endif // FCAROUGE_KALMAN_INTERNAL_OOSM_HPP
@@ -0,0 +1,189 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_INTERNAL_PARALLEL_HPP
+#define FCAROUGE_KALMAN_INTERNAL_PARALLEL_HPP
+
+#include <cstddef>
+
+#ifdef FCAROUGE_KALMAN_PARALLEL
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+#endif
+
+namespace fcarouge::kalman_internal {
+#ifdef FCAROUGE_KALMAN_PARALLEL
+//! @brief A persistent pool of worker threads sharing the loops iterations.
+//!
+//! @details The calling thread participates in the loop with the workers. The
+//! iterations are claimed in chunks without allocation nor type erasure
+//! through the heap. A loop started from within a loop, such as in a filter of
+//! filters, runs sequentially on its thread. The loop body must not throw.
+class thread_pool final {
+public:
+  explicit thread_pool(std::size_t concurrency) {
+    workers.reserve(concurrency);
+    for (std::size_t index{0}; index < concurrency; ++index) {
+      workers.emplace_back(
+          [this](std::stop_token token) { work(std::move(token)); });
+    }
+  }
+
+  thread_pool(const thread_pool &other) = delete;
+  thread_pool &operator=(const thread_pool &other) = delete;
+  thread_pool(thread_pool &&other) = delete;
+  thread_pool &operator=(thread_pool &&other) = delete;
+  ~thread_pool() = default;
+
+  //! @brief Calls the `function(begin, end)` over the `[0, count)` range in
+  //! chunks, until all chunks complete.
+  template <typename Function>
+  void run(std::size_t count, Function &function) {
+    if (worker || workers.empty() || count < 2) {
+      function(std::size_t{0}, count);
+      return;
+    }
+
+    std::scoped_lock entry{serialization};
+    {
+      std::scoped_lock lock{mutex};
+      task = [](void *callable, std::size_t begin, std::size_t end) {
+        (*static_cast<Function *>(callable))(begin, end);
+      };
+      context = std::addressof(function);
+      total = count;
+      chunks = std::min(count, (workers.size() + 1) * granularity);
+      next = 0;
+      active = workers.size();
+      ++generation;
+    }
+    start.notify_all();
+    worker = true;
+    participate();
+    worker = false;
+
+    std::unique_lock lock{mutex};
+    finish.wait(lock, [this] { return active == 0; });
+  }
+
+private:
+  void work(std::stop_token token) {
+    worker = true;
+    std::size_t seen{0};
+    std::unique_lock lock{mutex};
+
+    while (start.wait(lock, token, [this, &seen] {
+      return generation != seen;
+    })) {
+      seen = generation;
+      lock.unlock();
+      participate();
+      lock.lock();
+      if (--active == 0) {
+        finish.notify_one();
+      }
+    }
+  }
+
+  void participate() {
+    for (std::size_t chunk{next.fetch_add(1, std::memory_order_relaxed)};
+         chunk < chunks;
+         chunk = next.fetch_add(1, std::memory_order_relaxed)) {
+      task(context, chunk * total / chunks, (chunk + 1) * total / chunks);
+    }
+  }
+
+  static constexpr std::size_t granularity{4};
+  static inline thread_local bool worker{false};
+
+  std::mutex serialization;
+  std::mutex mutex;
+  std::condition_variable_any start;
+  std::condition_variable finish;
+  void (*task)(void *, std::size_t, std::size_t){nullptr};
+  void *context{nullptr};
+  std::size_t total{0};
+  std::size_t chunks{0};
+  std::atomic<std::size_t> next{0};
+  std::size_t active{0};
+  std::size_t generation{0};
+  // Declared last for the workers to join first on destruction.
+  std::vector<std::jthread> workers;
+};
+
+//! @brief The process-wide pool, one worker per additional hardware thread.
+//!
+//! @details The workers start on the first concurrent loop.
+inline thread_pool &pool() {
+  static thread_pool instance{
+      std::max(std::thread::hardware_concurrency(), 1U) - 1};
+  return instance;
+}
+
+#endif
+
+//! @brief Parallel for loop.
+//!
+//! @details Calls the `function(index)` for each index of the `[0, count)`
+//! range, concurrently on the thread pool when the `FCAROUGE_KALMAN_PARALLEL`
+//! macro is defined, for example by linking the `kalman_parallel` target, and
+//! sequentially on the calling thread otherwise. The calls of distinct indexes
+//! must be independent.
+template <typename Function>
+void for_parallel(std::size_t count, Function &&function) {
+  auto chunk{[&function](std::size_t begin, std::size_t end) {
+    for (std::size_t index{begin}; index < end; ++index) {
+      function(index);
+    }
+  }};
+
+#ifdef FCAROUGE_KALMAN_PARALLEL
+  pool().run(count, chunk);
+#else
+  chunk(std::size_t{0}, count);
+#endif
+}
+} // namespace fcarouge::kalman_internal
+
+#endif // FCAROUGE_KALMAN_INTERNAL_PARALLEL_HPP
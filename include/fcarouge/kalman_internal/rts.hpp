@@ -0,0 +1,184 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_INTERNAL_RTS_HPP
+#define FCAROUGE_KALMAN_INTERNAL_RTS_HPP
+
+#include "history.hpp"
+#include "utility.hpp"
+
+#include <cstddef>
+#include <utility>
+
+namespace fcarouge::kalman_internal {
+//! @brief Rauch-Tung-Striebel (RTS) fixed-interval smoother.
+//!
+//! @details Wraps a linear filter. Each prediction of the forward filtering
+//! records the posterior estimate before the prediction, the state transition
+//! matrix F, and the prior estimate after the prediction. The records only hold
+//! these values, contiguously in the history storage. The backward pass then
+//! produces the smoothed estimates from the last step to the first, in constant
+//! memory.
+//!
+//! @tparam Filter The type of the wrapped `kalman` filter. The filter must
+//! expose its state transition matrix F.
+//! @tparam History The storage template of the records: `memory_history` or
+//! `mapped_history` for sequences larger than the memory.
+template <typename Filter,
+          template <typename> typename History = memory_history>
+class rts {
+public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief Type of the state estimate column vector X.
+  using state = Filter::state;
+
+  //! @brief Type of the estimated covariance matrix P.
+  using estimate_uncertainty = Filter::estimate_uncertainty;
+
+  //! @brief Type of the state transition matrix F.
+  using state_transition = Filter::state_transition;
+
+  //! @brief Type of the recorded values of a prediction.
+  struct record {
+    state posterior_x;
+    estimate_uncertainty posterior_p;
+    state_transition f;
+    state prior_x;
+    estimate_uncertainty prior_p;
+  };
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs the smoother of a filter.
+  //!
+  //! @param filter The forward filter, copied.
+  //! @param arguments The arguments forwarded to the history storage
+  //! construction.
+  constexpr explicit rts(const Filter &filter, auto &&...arguments)
+      : filtering{filter}, records{std::forward<decltype(arguments)>(
+                             arguments)...} {}
+
+  //! @brief Returns the filtered state estimate column vector X.
+  [[nodiscard]] constexpr auto x() const -> decltype(auto) {
+    return filtering.x();
+  }
+
+  //! @brief Returns the filtered estimated covariance matrix P.
+  [[nodiscard]] constexpr auto p() const -> decltype(auto) {
+    return filtering.p();
+  }
+
+  //! @brief Read, write the forward filter.
+  [[nodiscard]] constexpr auto filter(this auto &&self) -> decltype(auto) {
+    return (std::forward<decltype(self)>(self).filtering);
+  }
+
+  //! @brief Returns the number of recorded predictions.
+  [[nodiscard]] constexpr auto size() const -> std::size_t {
+    return records.size();
+  }
+
+  //! @brief Predicts the filter and records the prediction.
+  //!
+  //! @param arguments The prediction arguments forwarded to the filter.
+  constexpr void predict(const auto &...arguments) {
+    const state posterior_x{filtering.x()};
+    const estimate_uncertainty posterior_p{filtering.p()};
+    filtering.predict(arguments...);
+    records.push(record{posterior_x, posterior_p, filtering.f(), filtering.x(),
+                        filtering.p()});
+  }
+
+  //! @brief Updates the filter.
+  //!
+  //! @param arguments The update arguments forwarded to the filter.
+  constexpr void update(const auto &...arguments) {
+    filtering.update(arguments...);
+  }
+
+  //! @brief Produces the smoothed estimates.
+  //!
+  //! @details Invokes the function with the step index, the smoothed state,
+  //! and the smoothed estimate uncertainty from the last step to the first.
+  //! The step `size()` is the current filter estimate. The step `k` is the
+  //! estimate before the `k`-th recorded prediction.
+  //!
+  //! @param function The callable of the form `void(std::size_t, const state
+  //! &, const estimate_uncertainty &)`.
+  //!
+  //! @complexity Linear in the number of recorded predictions.
+  constexpr void smooth(auto &&function) const {
+    state smoothed_x{filtering.x()};
+    estimate_uncertainty smoothed_p{filtering.p()};
+    function(records.size(), smoothed_x, smoothed_p);
+
+    for (std::size_t index{records.size()}; index > 0; --index) {
+      const record &step{records[index - 1]};
+      const auto c{step.posterior_p * t(step.f) / step.prior_p};
+      smoothed_x = state{step.posterior_x + c * (smoothed_x - step.prior_x)};
+      smoothed_p = estimate_uncertainty{
+          step.posterior_p + c * (smoothed_p - step.prior_p) * t(c)};
+      function(index - 1, smoothed_x, smoothed_p);
+    }
+  }
+
+  //! @brief Removes the recorded predictions.
+  constexpr void clear() { records.clear(); }
+
+  //! @}
+
+private:
+  //! @name Private Member Variables
+  //! @{
+
+  Filter filtering;
+  History<record> records;
+
+  //! @}
+};
+
+template <typename Filter, typename... Arguments>
+rts(Filter, Arguments...) -> rts<Filter>;
+} // namespace fcarouge::kalman_internal
+
+#endif // FCAROUGE_KALMAN_INTERNAL_RTS_HPP
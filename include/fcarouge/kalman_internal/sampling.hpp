@@ -0,0 +1,119 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_INTERNAL_SAMPLING_HPP
+#define FCAROUGE_KALMAN_INTERNAL_SAMPLING_HPP
+
+#include "utility.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <random>
+
+namespace fcarouge::kalman_internal {
+// The specialization points of the sigma point, ensemble, and particle filters,
+// apart from the utilities such that the linear filters do not parse them.
+
+//! @brief Linear algebra juxtaposition specialization point.
+//!
+//! @details The contiguous storage type of `Count` juxtaposed values of the
+//! column vector `Type`, one value per column. Backends may specialize the
+//! juxtaposition to a matrix such that batched callables vectorize.
+template <typename Type, std::size_t Count> struct juxtaposes {
+  using type = std::array<Type, Count>;
+};
+
+//! @brief Juxtaposer helper type.
+template <typename Type, std::size_t Count>
+using juxtapose = juxtaposes<Type, Count>::type;
+
+//! @brief Linear algebra factorization specialization point.
+//!
+//! @details Computes the lower triangular `L` factor of the symmetric positive
+//! definite `value` such that `L * Lᵀ = value`, also known as the Cholesky
+//! factor or the matrix square root. Defaults to the square root found by
+//! argument-dependent lookup for singleton types.
+template <typename Type> struct factorizes {
+  [[nodiscard]] static constexpr auto operator()(const Type &value) {
+    using std::sqrt;
+    return sqrt(value);
+  }
+};
+
+//! @brief Factorization helper function.
+template <typename Type> constexpr auto factor(const Type &value) {
+  return factorizes<Type>{}(value);
+}
+
+//! @brief Linear algebra factor downdate specialization point.
+//!
+//! @details Computes the lower triangular factor of `L * Lᵀ - U * Uᵀ` from the
+//! `L` factor. Defaults to the factorization of the downdated product. Backends
+//! may specialize the downdate with successive rank-one downdates of the
+//! factor, of quadratic instead of cubic complexity.
+template <typename L, typename U> struct downdates {
+  [[nodiscard]] static constexpr auto operator()(const L &l, const U &u) -> L {
+    return factor(L{l * t(l) - u * t(u)});
+  }
+};
+
+//! @brief Factor downdate helper function.
+template <typename L, typename U>
+constexpr auto downdate(const L &l, const U &u) {
+  return downdates<L, U>{}(l, u);
+}
+
+//! @brief Standard normal sampling specialization point.
+//!
+//! @details Draws a value of independent standard normal elements from the
+//! pseudo-random number `engine`.
+template <typename Type> struct normals {
+  template <typename Engine>
+  [[nodiscard]] static auto operator()(Engine &engine) -> Type {
+    return std::normal_distribution<Type>{}(engine);
+  }
+};
+
+//! @brief Standard normal sampling helper function.
+template <typename Type, typename Engine> auto normal(Engine &engine) {
+  return normals<Type>{}(engine);
+}
+} // namespace fcarouge::kalman_internal
+
+#endif // FCAROUGE_KALMAN_INTERNAL_SAMPLING_HPP
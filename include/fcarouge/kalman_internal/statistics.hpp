@@ -0,0 +1,209 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_INTERNAL_STATISTICS_HPP
+#define FCAROUGE_KALMAN_INTERNAL_STATISTICS_HPP
+
+#include "sampling.hpp"
+#include "utility.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <type_traits>
+#include <utility>
+
+namespace fcarouge {
+namespace kalman_internal {
+//! @brief Filter decorator of the running consistency statistics.
+//!
+//! @details Each update computes incrementally, from the innovation Y and the
+//! innovation uncertainty S of the update, the normalized innovation squared
+//! (NIS) `Yᵀ * S⁻¹ * Y`, the logarithm of the Gaussian likelihood of the
+//! innovation, and the mean and covariance of the innovations over a sliding
+//! window. The window sums are maintained by adding the newest and subtracting
+//! the oldest innovation of a ring buffer, and recomputed from the ring buffer
+//! once per window to bound the rounding drift of the running sums. The mean
+//! and covariance of an empty window are zero. For online tuning, consistency
+//! checks, and fault detection.
+//!
+//! @tparam Filter The decorated `kalman` filter, exposing its innovation and
+//! innovation uncertainty.
+//! @tparam Window The number of innovations of the sliding window.
+template <typename Filter, std::size_t Window>
+class statistician : public Filter {
+public:
+  using innovation = Filter::innovation;
+  using innovation_uncertainty = Filter::innovation_uncertainty;
+  using innovation_covariance = ᴀʙᵀ<innovation, innovation>;
+  using value = std::remove_cvref_t<decltype(element(
+      std::declval<innovation &>(), std::size_t{0}))>;
+
+  constexpr explicit statistician(Filter &&filter);
+
+  //! @brief Returns the normalized innovation squared of the last update.
+  [[nodiscard]] constexpr auto nis() const -> value;
+
+  //! @brief Returns the logarithm of the likelihood of the last update.
+  [[nodiscard]] constexpr auto log_likelihood() const -> value;
+
+  //! @brief Returns the mean of the innovations of the window.
+  [[nodiscard]] constexpr auto mean() const -> innovation;
+
+  //! @brief Returns the covariance of the innovations of the window.
+  [[nodiscard]] constexpr auto variance() const -> innovation_covariance;
+
+  //! @brief Returns the number of innovations of the window.
+  [[nodiscard]] constexpr auto size() const -> std::size_t;
+
+  using Filter::update;
+
+  constexpr void update(const auto &...arguments);
+
+private:
+  std::array<innovation, Window> innovations{};
+  std::size_t updates{0};
+  innovation sum{zero<innovation>};
+  innovation_covariance squares{zero<innovation_covariance>};
+  value normalized{0};
+  value likelihood{0};
+};
+
+template <typename Filter, std::size_t Window>
+constexpr statistician<Filter, Window>::statistician(Filter &&filter)
+    : Filter{std::forward<Filter>(filter)} {
+  static_assert(Window > 0, "The statistics window must not be empty.");
+}
+
+template <typename Filter, std::size_t Window>
+constexpr auto statistician<Filter, Window>::nis() const -> value {
+  return normalized;
+}
+
+template <typename Filter, std::size_t Window>
+constexpr auto statistician<Filter, Window>::log_likelihood() const -> value {
+  return likelihood;
+}
+
+template <typename Filter, std::size_t Window>
+constexpr auto statistician<Filter, Window>::mean() const -> innovation {
+  if (size() == 0) {
+    return zero<innovation>;
+  }
+
+  return innovation{sum / static_cast<value>(size())};
+}
+
+template <typename Filter, std::size_t Window>
+constexpr auto statistician<Filter, Window>::variance() const
+    -> innovation_covariance {
+  if (size() == 0) {
+    return zero<innovation_covariance>;
+  }
+
+  const innovation average{mean()};
+  return innovation_covariance{squares / static_cast<value>(size()) -
+                               average * t(average)};
+}
+
+template <typename Filter, std::size_t Window>
+constexpr auto statistician<Filter, Window>::size() const -> std::size_t {
+  return updates < Window ? updates : Window;
+}
+
+template <typename Filter, std::size_t Window>
+constexpr void statistician<Filter, Window>::update(const auto &...arguments) {
+  using distance =
+      evaluate<product<evaluate<transpose<innovation>>, innovation>>;
+
+  Filter::update(arguments...);
+
+  // The innovation uncertainty is factored once, S = L * Lᵀ. The NIS is the
+  // squared norm of the whitened innovation L⁻¹ * Y, and the logarithm of the
+  // determinant of S is twice the sum of the logarithms of the diagonal of L.
+  constexpr std::size_t size{dimension<innovation>};
+  const innovation &y{Filter::y()};
+  auto l{factor(Filter::s())};
+  const innovation whitened{
+      innovation_uncertainty{one<innovation_uncertainty> / l} * y};
+  distance squared{t(whitened) * whitened};
+  normalized = element(squared, 0);
+  using std::log;
+  value logarithm{0};
+  for (std::size_t index{0}; index < size; ++index) {
+    logarithm += log(element(l, index * (size + 1)));
+  }
+  likelihood = -(normalized + 2 * logarithm +
+                 static_cast<value>(size) *
+                     log(2 * std::numbers::pi_v<value>)) /
+               2;
+
+  innovation &slot{innovations[updates % Window]};
+  if (updates >= Window) {
+    sum = innovation{sum - slot};
+    squares = innovation_covariance{squares - slot * t(slot)};
+  }
+  slot = y;
+  ++updates;
+  if (updates % Window == 0) {
+    sum = zero<innovation>;
+    squares = zero<innovation_covariance>;
+    for (const innovation &past : innovations) {
+      sum = innovation{sum + past};
+      squares = innovation_covariance{squares + past * t(past)};
+    }
+  } else {
+    sum = innovation{sum + y};
+    squares = innovation_covariance{squares + y * t(y)};
+  }
+}
+} // namespace kalman_internal
+
+template <std::size_t Window> struct statistician {};
+
+template <typename Filter, std::size_t Window>
+[[nodiscard]] constexpr auto
+operator|(Filter &&filter,
+          [[maybe_unused]] const statistician<Window> &decorator) {
+  return kalman_internal::statistician<Filter, Window>(
+      std::forward<Filter>(filter));
+}
+} // namespace fcarouge
+
+#endif // FCAROUGE_KALMAN_INTERNAL_STATISTICS_HPP
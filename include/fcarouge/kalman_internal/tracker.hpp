@@ -0,0 +1,488 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_INTERNAL_TRACKER_HPP
+#define FCAROUGE_KALMAN_INTERNAL_TRACKER_HPP
+
+#include "factorization.hpp"
+#include "parallel.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fcarouge::kalman_internal {
+//! @brief Multiple object tracker.
+//!
+//! @details Tracks many objects with one filter per object, held in a
+//! contiguous pool of preallocated filter slots. Each update of a frame of
+//! detections gates the pairs of tracks and detections by their squared
+//! Mahalanobis distance against the predicted measurement of the tracks, in a
+//! parallel pass over the tracks. The filters of the tracks are decorated with
+//! the gating decorator, such that each track factors its innovation
+//! uncertainty once per prediction or update. The gated pairs form the clusters of an assignment
+//! problem solved optimally per cluster by the Hungarian method on reused
+//! buffers. The assigned detections update their track. The unassigned tracks
+//! die after a number of consecutive misses, recycling their slot. The
+//! unassigned detections give birth to tracks in the free slots.
+//!
+//! @tparam Filter The `kalman` filter type of the tracks. The filter must be
+//! copyable and expose its output model H, output uncertainty R, and estimate
+//! uncertainty P.
+//! @tparam Initializer The callable type initializing the filter of a track
+//! from its first detection, of the form `void(Filter &, const output &)`.
+//!
+//! @todo Support confirmation of tentative tracks?
+template <typename Filter, typename Initializer> class tracker {
+public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief Type of the state estimate column vector X.
+  using state = Filter::state;
+
+  //! @brief Type of the observation column vector Z.
+  using output = Filter::output;
+
+  //! @brief Type of the estimated covariance matrix P.
+  using estimate_uncertainty = Filter::estimate_uncertainty;
+
+  //! @brief Type of the filters of the tracks, gating decorated.
+  using gated_filter = gater<Filter>;
+
+  //! @brief Type of the assignment costs, the squared distances.
+  using cost = std::remove_cvref_t<decltype(element(std::declval<state &>(),
+                                                    std::size_t{0}))>;
+
+  //! @brief Track of an object.
+  struct track {
+    //! @brief Unique identifier of the track.
+    std::size_t identifier{0};
+
+    //! @brief Slot of the filter of the track in the pool.
+    std::size_t slot{0};
+
+    //! @brief Number of assigned detections.
+    std::size_t hits{0};
+
+    //! @brief Number of consecutive unassigned updates.
+    std::size_t misses{0};
+  };
+
+  //! @brief Assignment value of an untracked detection.
+  static constexpr std::size_t untracked{
+      std::numeric_limits<std::size_t>::max()};
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs the tracker and its pool of filters.
+  //!
+  //! @details The gate defaults to the 95% quantile of the chi-square
+  //! distribution of the output dimension. The tracks die after more than three
+  //! consecutive misses.
+  //!
+  //! @param prototype The filter copied to each slot of the pool and at each
+  //! track birth.
+  //! @param initialize The callable initializing the filter of a born track
+  //! from its detection.
+  //! @param capacity The maximum number of tracks.
+  constexpr tracker(const Filter &prototype, Initializer initialize,
+                    std::size_t capacity)
+      : model{Filter{prototype}}, initializer{std::move(initialize)},
+        filters(capacity, model) {
+    live.reserve(capacity);
+    free.resize(capacity);
+    std::iota(free.rbegin(), free.rend(), std::size_t{0});
+    gates.resize(capacity);
+  }
+
+  //! @brief Returns the live tracks.
+  [[nodiscard]] constexpr auto tracks() const -> std::span<const track> {
+    return live;
+  }
+
+  //! @brief Read, write the filter of the slot.
+  [[nodiscard]] constexpr auto filter(this auto &&self, std::size_t slot)
+      -> decltype(auto) {
+    return std::forward<decltype(self)>(self).filters[slot];
+  }
+
+  //! @brief Returns the identifier of the track of each detection of the last
+  //! update, assigned or born, or `untracked`.
+  [[nodiscard]] constexpr auto assignments() const
+      -> std::span<const std::size_t> {
+    return associated;
+  }
+
+  //! @brief Read, write the gate on the squared Mahalanobis distance.
+  [[nodiscard]] constexpr auto gate(this auto &&self) -> decltype(auto) {
+    return (std::forward<decltype(self)>(self).threshold);
+  }
+
+  //! @brief Read, write the maximum number of consecutive misses of a track.
+  [[nodiscard]] constexpr auto misses(this auto &&self) -> decltype(auto) {
+    return (std::forward<decltype(self)>(self).maximum_misses);
+  }
+
+  //! @brief Predicts the filters of the live tracks.
+  //!
+  //! @param arguments The prediction arguments forwarded to each filter.
+  constexpr void predict(const auto &...arguments) {
+    for_parallel(live.size(), [this, &arguments...](std::size_t index) {
+      filters[live[index].slot].predict(arguments...);
+    });
+  }
+
+  //! @brief Updates the tracks with a frame of detections.
+  //!
+  //! @details Gates, assigns, updates, and manages the births and deaths of
+  //! the tracks. A detection is left untracked when the pool is full.
+  //!
+  //! @param detections The measurements of the frame.
+  //!
+  //! @complexity Linear in the product of the numbers of tracks and
+  //! detections for the gating, cubic in the size of the largest cluster for
+  //! the assignment.
+  constexpr void update(std::span<const output> detections) {
+    gating(detections);
+    assign(detections.size());
+
+    for_parallel(matches.size(), [this, detections](std::size_t index) {
+      const auto [track_index, detection] = matches[index];
+      filters[live[track_index].slot].update(detections[detection]);
+    });
+
+    associated.assign(detections.size(), untracked);
+    for (const auto &[track_index, detection] : matches) {
+      track &matched{live[track_index]};
+      ++matched.hits;
+      matched.misses = 0;
+      associated[detection] = matched.identifier;
+      assigned[track_index] = true;
+    }
+
+    for (std::size_t index{live.size()}; index > 0; --index) {
+      track &missed{live[index - 1]};
+      if (!assigned[index - 1] && ++missed.misses > maximum_misses) {
+        free.push_back(missed.slot);
+        missed = live.back();
+        live.pop_back();
+      }
+    }
+
+    for (std::size_t detection{0}; detection < detections.size();
+         ++detection) {
+      if (associated[detection] == untracked && !free.empty()) {
+        const std::size_t slot{free.back()};
+        free.pop_back();
+        filters[slot] = model;
+        initializer(filters[slot], detections[detection]);
+        live.push_back({identifiers, slot, 1, 0});
+        associated[detection] = identifiers++;
+      }
+    }
+  }
+
+  //! @}
+
+private:
+  //! @name Private Member Types
+  //! @{
+
+  // A gated detection of a track.
+  struct candidate {
+    std::size_t detection;
+    cost squared;
+  };
+
+  //! @}
+
+  //! @name Private Member Functions
+  //! @{
+
+  // The default gate, the 95% chi-square quantile of the output dimension.
+  // Tabulated for the smaller dimensions, approximated by the Wilson-Hilferty
+  // transformation otherwise.
+  [[nodiscard]] static auto chi_square() -> cost {
+    constexpr std::array<cost, 9> quantiles{
+        cost{3.8415F}, cost{5.9915F}, cost{7.8147F},
+        cost{9.4877F}, cost{11.070F}, cost{12.592F},
+        cost{14.067F}, cost{15.507F}, cost{16.919F}};
+    if constexpr (dimension<output> <= quantiles.size()) {
+      return quantiles[dimension<output> - 1];
+    } else {
+      const cost k{static_cast<cost>(dimension<output>)};
+      const cost cube{1 - 2 / (9 * k) +
+                      cost{1.6449F} * std::sqrt(2 / (9 * k))};
+      return k * cube * cube * cube;
+    }
+  }
+
+  // Gates the detections of each track by their squared Mahalanobis distance
+  // against the predicted measurement of the track, with the cached
+  // factorization of the innovation uncertainty of the track. The squared
+  // distance is at least the squared first element of the innovation over its
+  // variance, such that only the detections sorted by first element within the
+  // gate of the first element are evaluated.
+  constexpr void gating(std::span<const output> detections) {
+    using distance = evaluate<product<evaluate<transpose<output>>, output>>;
+
+    keys.resize(detections.size());
+    sorted.resize(detections.size());
+    for (std::size_t detection{0}; detection < detections.size();
+         ++detection) {
+      output value{detections[detection]};
+      keys[detection] = element(value, 0);
+    }
+    std::iota(sorted.begin(), sorted.end(), std::size_t{0});
+    std::ranges::sort(sorted, {}, [this](std::size_t detection) {
+      return keys[detection];
+    });
+    std::ranges::sort(keys);
+
+    for_parallel(live.size(), [this, detections](std::size_t index) {
+      gated_filter &tracked{filters[live[index].slot]};
+      output predicted{std::as_const(tracked).h() * tracked.x()};
+      output first{zero<output>};
+      element(first, 0) = 1;
+      distance variance{t(first) * tracked.uncertainty() * first};
+      const cost center{element(predicted, 0)};
+      const cost radius{std::sqrt(threshold * element(variance, 0))};
+
+      std::vector<candidate> &gated{gates[index]};
+      gated.clear();
+      for (auto key{std::ranges::lower_bound(keys, center - radius)};
+           key != keys.end() && *key <= center + radius; ++key) {
+        gated.push_back(
+            {sorted[static_cast<std::size_t>(key - keys.begin())], cost{0}});
+      }
+      tracked.mahalanobis(
+          std::views::transform(gated,
+                                [detections](const candidate &pair)
+                                    -> const output & {
+                                  return detections[pair.detection];
+                                }),
+          std::views::transform(gated, &candidate::squared));
+      std::erase_if(gated, [this](const candidate &pair) {
+        return pair.squared > threshold;
+      });
+    });
+  }
+
+  // Finds the root of the cluster of the node, halving the paths.
+  [[nodiscard]] constexpr auto root(std::size_t node) -> std::size_t {
+    while (clusters[node] != node) {
+      clusters[node] = clusters[clusters[node]];
+      node = clusters[node];
+    }
+    return node;
+  }
+
+  // Assigns the gated detections to the tracks, optimally per cluster of
+  // tracks and detections connected by gated pairs. The tracks nodes precede
+  // the detections nodes.
+  constexpr void assign(std::size_t detections) {
+    const std::size_t tracks{live.size()};
+    matches.clear();
+    assigned.assign(tracks, false);
+    clusters.resize(tracks + detections);
+    std::iota(clusters.begin(), clusters.end(), std::size_t{0});
+    for (std::size_t index{0}; index < tracks; ++index) {
+      for (const candidate &gated : gates[index]) {
+        clusters[root(tracks + gated.detection)] = root(index);
+      }
+    }
+
+    // Buckets the nodes by cluster root, each cluster contiguous.
+    members.assign(tracks + detections + 1, 0);
+    for (std::size_t node{0}; node < tracks + detections; ++node) {
+      ++members[root(node) + 1];
+    }
+    std::partial_sum(members.begin(), members.end(), members.begin());
+    order.resize(tracks + detections);
+    offsets.assign(members.begin(), members.end() - 1);
+    for (std::size_t node{0}; node < tracks + detections; ++node) {
+      order[offsets[root(node)]++] = node;
+    }
+
+    columns.resize(detections);
+    for (std::size_t cluster{0}; cluster < tracks + detections; ++cluster) {
+      const std::size_t begin{members[cluster]};
+      const std::size_t end{members[cluster + 1]};
+      const std::size_t rows{static_cast<std::size_t>(
+          std::lower_bound(order.begin() + begin, order.begin() + end,
+                           tracks) -
+          order.begin()) - begin};
+      const std::size_t cols{end - begin - rows};
+      if (rows > 0 && cols > 0) {
+        solve(std::span{order}.subspan(begin, rows),
+              std::span{order}.subspan(begin + rows, cols));
+      }
+    }
+  }
+
+  // Solves the assignment of the cluster tracks to the cluster detections by
+  // the Hungarian method, minimizing the sum of the squared distances. The
+  // ungated pairs cost more than any set of gated pairs and are discarded.
+  constexpr void solve(std::span<const std::size_t> rows,
+                       std::span<const std::size_t> cols) {
+    const std::size_t tracks{live.size()};
+    const bool transposed{rows.size() > cols.size()};
+    const std::size_t n{transposed ? cols.size() : rows.size()};
+    const std::size_t m{transposed ? rows.size() : cols.size()};
+    const cost forbidden{threshold * static_cast<cost>(n + m + 1)};
+
+    for (std::size_t col{0}; col < cols.size(); ++col) {
+      columns[cols[col] - tracks] = col;
+    }
+    costs.assign(n * m, forbidden);
+    for (std::size_t row{0}; row < rows.size(); ++row) {
+      for (const candidate &gated : gates[rows[row]]) {
+        const std::size_t col{columns[gated.detection]};
+        costs[transposed ? col * m + row : row * m + col] = gated.squared;
+      }
+    }
+
+    // The one-based potentials and augmenting paths formulation.
+    constexpr cost infinity{std::numeric_limits<cost>::infinity()};
+    row_potentials.assign(n + 1, cost{0});
+    column_potentials.assign(m + 1, cost{0});
+    owners.assign(m + 1, 0);
+    previous.assign(m + 1, 0);
+    for (std::size_t i{1}; i <= n; ++i) {
+      owners[0] = i;
+      std::size_t j0{0};
+      minimums.assign(m + 1, infinity);
+      visited.assign(m + 1, false);
+      do {
+        visited[j0] = true;
+        const std::size_t i0{owners[j0]};
+        cost delta{infinity};
+        std::size_t j1{0};
+        for (std::size_t j{1}; j <= m; ++j) {
+          if (!visited[j]) {
+            const cost reduced{costs[(i0 - 1) * m + j - 1] -
+                               row_potentials[i0] - column_potentials[j]};
+            if (reduced < minimums[j]) {
+              minimums[j] = reduced;
+              previous[j] = j0;
+            }
+            if (minimums[j] < delta) {
+              delta = minimums[j];
+              j1 = j;
+            }
+          }
+        }
+        for (std::size_t j{0}; j <= m; ++j) {
+          if (visited[j]) {
+            row_potentials[owners[j]] += delta;
+            column_potentials[j] -= delta;
+          } else {
+            minimums[j] -= delta;
+          }
+        }
+        j0 = j1;
+      } while (owners[j0] != 0);
+      do {
+        const std::size_t j1{previous[j0]};
+        owners[j0] = owners[j1];
+        j0 = j1;
+      } while (j0 != 0);
+    }
+
+    for (std::size_t j{1}; j <= m; ++j) {
+      if (owners[j] != 0 &&
+          costs[(owners[j] - 1) * m + j - 1] < forbidden) {
+        const std::size_t row{transposed ? j - 1 : owners[j] - 1};
+        const std::size_t col{transposed ? owners[j] - 1 : j - 1};
+        matches.emplace_back(rows[row], cols[col] - tracks);
+      }
+    }
+  }
+
+  //! @}
+
+  //! @name Private Member Variables
+  //! @{
+
+  gated_filter model;
+  Initializer initializer;
+  std::vector<gated_filter> filters;
+  std::vector<track> live;
+  std::vector<std::size_t> free;
+  std::vector<std::size_t> associated;
+  std::size_t identifiers{0};
+  cost threshold{chi_square()};
+  std::size_t maximum_misses{3};
+
+  // The reused buffers of the gating and of the assignment.
+  std::vector<cost> keys;
+  std::vector<std::size_t> sorted;
+  std::vector<std::vector<candidate>> gates;
+  std::vector<std::pair<std::size_t, std::size_t>> matches;
+  std::vector<bool> assigned;
+  std::vector<std::size_t> clusters;
+  std::vector<std::size_t> members;
+  std::vector<std::size_t> offsets;
+  std::vector<std::size_t> order;
+  std::vector<std::size_t> columns;
+  std::vector<cost> costs;
+  std::vector<cost> row_potentials;
+  std::vector<cost> column_potentials;
+  std::vector<cost> minimums;
+  std::vector<std::size_t> owners;
+  std::vector<std::size_t> previous;
+  std::vector<bool> visited;
+
+  //! @}
+};
+} // namespace fcarouge::kalman_internal
+
+#endif // FCAROUGE_KALMAN_INTERNAL_TRACKER_HPP
@@ -41,6 +41,9 @@ For more information, please refer to <https://unlicense.org> */
 
 #include "utility.hpp"
 
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <type_traits>
 
@@ -227,6 +230,191 @@ template <typename Type> struct observation {
 
 template <typename Element> observation(Element) -> observation<Element>;
 
+//! @brief Error state type.
+//!
+//! @details The minimal dimension column vector of the error of the nominal
+//! state, in the tangent space of the state manifold.
+template <typename Type> struct error_state_t {
+  using type = Type;
+};
+
+template <typename Type> inline error_state_t<Type> error_state{};
+
+//! @brief Retraction of the nominal state by an error.
+//!
+//! @details The `x ⊞ δx` function of the nominal state `x` and error `δx`.
+template <typename Type> struct retraction {
+  using type = Type;
+
+  Type value;
+
+  template <typename Element>
+  constexpr explicit retraction(Element rr) : value{rr} {}
+};
+
+template <typename Element> retraction(Element) -> retraction<Element>;
+
+//! @brief Local difference of two outputs.
+//!
+//! @details The `z ⊟ ẑ` function of the measured `z` and the expected `ẑ`
+//! outputs, the innovation in the tangent space of the output manifold.
+template <typename Type> struct local {
+  using type = Type;
+
+  Type value;
+
+  template <typename Element>
+  constexpr explicit local(Element ll) : value{ll} {}
+};
+
+template <typename Element> local(Element) -> local<Element>;
+
+//! @brief Unscented transform sigma points parameters.
+//!
+//! @details The `alpha` spread of the sigma points around the mean, the `beta`
+//! prior knowledge of the distribution with two optimal for Gaussians, and the
+//! `kappa` secondary scaling. The parameters type is the scalar type of the
+//! state.
+template <typename Type> struct sigma_points {
+  using type = Type;
+
+  Type alpha{1};
+  Type beta{2};
+  Type kappa{0};
+};
+
+template <typename Type>
+sigma_points(Type, Type, Type) -> sigma_points<Type>;
+
+//! @brief Spherical-radial cubature points parameters.
+//!
+//! @details The type is the scalar type of the state.
+template <typename Type> struct cubature_points_t {
+  using type = Type;
+};
+
+template <typename Type = double>
+inline cubature_points_t<Type> cubature_points{};
+
+//! @brief Ensemble parameters.
+//!
+//! @details The `Size` number of members of the ensemble, and the `seed` of the
+//! pseudo-random sampling of the members and of their perturbations. The type
+//! is the scalar type of the state.
+template <typename Type, std::size_t Size> struct ensemble_t {
+  using type = Type;
+
+  std::uint_fast64_t seed{5489U};
+};
+
+template <typename Type, std::size_t Size>
+inline ensemble_t<Type, Size> ensemble{};
+
+//! @brief Particles parameters.
+//!
+//! @details The `count` of particles, the `seed` of the pseudo-random sampling
+//! of the particles, of their process noise, and of their resampling, and the
+//! `threshold` fraction of the count below which the effective sample size of
+//! the weighted particles triggers their resampling. A zero threshold never
+//! resamples, a one threshold resamples on every informative update. The type
+//! is the scalar type of the state.
+template <typename Type> struct particles {
+  using type = Type;
+
+  std::size_t count{1000};
+  std::uint_fast64_t seed{5489U};
+  Type threshold{0.5};
+};
+
+//! @brief Iterated update parameters.
+//!
+//! @details The maximum `count` of linearizations of the update, and the
+//! `tolerance` of the Euclidean norm of the state step below which the
+//! iterations exit early. One linearization is the extended filter update. A
+//! zero count is one linearization. The type is the scalar type of the state.
+template <typename Type> struct iterations {
+  using type = Type;
+
+  std::size_t count{1};
+  Type tolerance{0};
+};
+
+template <typename Type>
+iterations(std::size_t, Type) -> iterations<Type>;
+
+//! @brief Sensor name.
+//!
+//! @details The type naming a sensor, usually an empty tag type.
+template <typename Type> struct name_t {
+  using type = Type;
+};
+
+template <typename Type> inline name_t<Type> name{};
+
+//! @brief Sensor measurement model.
+//!
+//! @details The output type, output model H, and output uncertainty R of a
+//! sensor measuring the state. The sensor is optionally named for selecting its
+//! measurement model at compile-time.
+template <typename Output, typename Model, typename Uncertainty,
+          typename Name = void>
+struct sensor {
+  using output = Output;
+  using name = Name;
+
+  Model h;
+  Uncertainty r;
+
+  constexpr sensor([[maybe_unused]] output_t<Output> z,
+                   output_model<Model> hh, output_uncertainty<Uncertainty> rr)
+      : h{hh.value}, r{rr.value} {}
+
+  constexpr sensor([[maybe_unused]] name_t<Name> n, output_t<Output> z,
+                   output_model<Model> hh, output_uncertainty<Uncertainty> rr)
+      : sensor{z, hh, rr} {}
+};
+
+template <typename Output, typename Model, typename Uncertainty>
+sensor(output_t<Output>, output_model<Model>, output_uncertainty<Uncertainty>)
+    -> sensor<Output, Model, Uncertainty>;
+
+template <typename Name, typename Output, typename Model, typename Uncertainty>
+sensor(name_t<Name>, output_t<Output>, output_model<Model>,
+       output_uncertainty<Uncertainty>)
+    -> sensor<Output, Model, Uncertainty, Name>;
+
+//! @brief Linear equality constraint of the state.
+//!
+//! @details The constraint model D and value d of the `D * x = d` hard
+//! constraint of the state x. The rows of the model are linearly independent.
+template <typename Model, typename Value> struct equality_constraint {
+  static constexpr bool equality{true};
+
+  Model model;
+  Value value;
+
+  constexpr equality_constraint(Model d, Value v) : model{d}, value{v} {}
+};
+
+//! @brief Linear inequality constraint of the state.
+//!
+//! @details The constraint model D and value d of the `D * x <= d` hard
+//! constraint of the state x, row by row.
+template <typename Model, typename Value> struct inequality_constraint {
+  static constexpr bool equality{false};
+
+  Model model;
+  Value value;
+
+  constexpr inequality_constraint(Model d, Value v) : model{d}, value{v} {}
+};
+
+//! @brief State constraint declaration concept.
+template <typename Type>
+concept constraint = requires {
+  { Type::equality } -> std::convertible_to<bool>;
+};
+
 //! @todo Better name not ending by *_types?
 template <typename... Types> struct update_types_t {};
 
@@ -349,6 +349,186 @@ template <typename Type> auto t(const Type &value) {
   return transposes<Type>{}(value);
 }
 
+//! @brief Linear algebra covariance propagation specialization point.
+//!
+//! @details Computes the `A * P * Aᵀ + Q` propagation of the estimate
+//! uncertainty `P` through the `A` transition with the added `Q` uncertainty.
+//! The expression dominates the cost of the prediction. Backends may specialize
+//! the propagation with an optimized kernel.
+template <typename A, typename P, typename Q> struct propagates {
+  [[nodiscard]] static constexpr auto operator()(const A &a, const P &p,
+                                                 const Q &q) {
+    return a * p * t(a) + q;
+  }
+};
+
+//! @brief Covariance propagation helper function.
+template <typename A, typename P, typename Q>
+constexpr auto propagate(const A &a, const P &p, const Q &q) {
+  return propagates<A, P, Q>{}(a, p, q);
+}
+
+//! @brief Linear algebra Joseph form covariance correction specialization
+//! point.
+//!
+//! @details Computes the `A * P * Aᵀ + K * R * Kᵀ` Joseph form update of the
+//! estimate uncertainty `P`, where `A = I - K * H`. The expression dominates
+//! the cost of the update. Backends may specialize the correction with an
+//! optimized kernel.
+template <typename A, typename P, typename K, typename R> struct corrects {
+  [[nodiscard]] static constexpr auto operator()(const A &a, const P &p,
+                                                 const K &k, const R &r) {
+    return a * p * t(a) + k * r * t(k);
+  }
+};
+
+//! @brief Joseph form covariance correction helper function.
+template <typename A, typename P, typename K, typename R>
+constexpr auto correct(const A &a, const P &p, const K &k, const R &r) {
+  return corrects<A, P, K, R>{}(a, p, k, r);
+}
+
+//! @brief Linear algebra gain weighing specialization point.
+//!
+//! @details Computes the `P * Hᵀ / S` gain of the estimate uncertainty `P`
+//! projected by the `H` output model and weighed by the innovation uncertainty
+//! `S`. The product is the largest term of the gain. Backends may specialize
+//! the weighing with an optimized kernel.
+template <typename P, typename H, typename S> struct weighs {
+  [[nodiscard]] static constexpr auto operator()(const P &p, const H &h,
+                                                 const S &s) {
+    return p * t(h) / s;
+  }
+};
+
+//! @brief Gain weighing helper function.
+template <typename P, typename H, typename S>
+constexpr auto weigh(const P &p, const H &h, const S &s) {
+  return weighs<P, H, S>{}(p, h, s);
+}
+
+//! @brief Number of scalar elements of a column vector type.
+//!
+//! @details One for arithmetic types, the tuple size otherwise.
+template <typename Type> inline constexpr std::size_t dimension{1};
+
+template <typename Type>
+  requires requires { std::tuple_size<Type>::value; }
+inline constexpr std::size_t dimension<Type>{std::tuple_size_v<Type>};
+
+//! @brief Linear algebra scalar rebinding specialization point.
+//!
+//! @details The type of the same shape as `Type` with `Scalar` elements.
+//! Defaults to the scalar for singleton types. Backends may specialize the
+//! rebinding such that callables evaluate over other scalars, for example the
+//! dual numbers of the automatic differentiation.
+template <typename Type, typename Scalar> struct rebinds {
+  using type = Scalar;
+};
+
+//! @brief Rebinder helper type.
+template <typename Type, typename Scalar>
+using rebind = rebinds<Type, Scalar>::type;
+
+//! @brief Linear algebra column access specialization point.
+template <typename Type> struct columns {
+  [[nodiscard]] static constexpr decltype(auto) operator()(Type &value,
+                                                           std::size_t index) {
+    return value[index];
+  }
+};
+
+template <arithmetic Arithmetic> struct columns<Arithmetic> {
+  [[nodiscard]] static constexpr auto &
+  operator()(Arithmetic &value, [[maybe_unused]] std::size_t index) {
+    return value;
+  }
+};
+
+//! @brief Column access helper function.
+//!
+//! @details The `index` column of the `value` matrix, or of the juxtaposition.
+template <typename Type>
+constexpr decltype(auto) column(Type &value, std::size_t index) {
+  return columns<Type>{}(value, index);
+}
+
+//! @brief Linear algebra element access specialization point.
+template <typename Type> struct elements {
+  [[nodiscard]] static constexpr decltype(auto) operator()(Type &value,
+                                                           std::size_t index) {
+    return value[index];
+  }
+};
+
+template <arithmetic Arithmetic> struct elements<Arithmetic> {
+  [[nodiscard]] static constexpr auto &
+  operator()(Arithmetic &value, [[maybe_unused]] std::size_t index) {
+    return value;
+  }
+};
+
+//! @brief Element access helper function.
+//!
+//! @details The `index` element of the `value` column vector.
+template <typename Type>
+constexpr decltype(auto) element(Type &value, std::size_t index) {
+  return elements<Type>{}(value, index);
+}
+
+//! @brief Scalar element type helper of a column vector type.
+template <typename Type>
+using scalar_of = std::remove_cvref_t<decltype(element(
+    std::declval<std::remove_cvref_t<Type> &>(), std::size_t{0}))>;
+
+//! @brief Squared Euclidean norm helper function of a column vector.
+template <typename Type> constexpr auto squared_norm(const Type &value) {
+  Type copy{value};
+  scalar_of<Type> result{0};
+  for (std::size_t index{0}; index < dimension<Type>; ++index) {
+    const scalar_of<Type> coefficient{element(copy, index)};
+    result += coefficient * coefficient;
+  }
+  return result;
+}
+
+//! @brief Forward-mode automatic differentiation dual number.
+//!
+//! @details Only declared for the deducer to name the differentiable types. The
+//! dual number header defines it, the Eigen backend includes it.
+template <typename Type, std::size_t Size> struct dual;
+
+//! @brief Differentiable type helper of a column vector type.
+//!
+//! @details The column vector of dual numbers with one partial derivative per
+//! element of the column vector.
+template <typename Type>
+using differentiable = rebind<Type, dual<scalar_of<Type>, dimension<Type>>>;
+
+//! @brief Jacobian of a function by forward-mode automatic differentiation.
+//!
+//! @details Only declared for the deducer. The dual number header defines it.
+template <typename Jacobian, typename State, typename Function,
+          typename... Arguments>
+[[nodiscard]] constexpr auto jacobian(Function &&function, const State &x,
+                                      const Arguments &...arguments)
+    -> Jacobian;
+
+//! @brief Linear algebra determinant specialization point.
+//!
+//! @details Computes the determinant of the square `value`. Defaults to the
+//! value itself for singleton types.
+template <typename Type> struct determinants {
+  [[nodiscard]] static constexpr auto operator()(const Type &value) {
+    return value;
+  }
+};
+
+//! @brief Determinant helper function.
+template <typename Type> constexpr auto determinant(const Type &value) {
+  return determinants<Type>{}(value);
+}
+
 //! @brief Unpack the first type of the type template parameter pack.
 //!
 //! @details Shorthand for `std::tuple_element_t<0, std::tuple<Types...>>`.
@@ -69,7 +69,7 @@ template <typename Type> struct x_z_p_q_r {
     k = p / s;
     y = z - x;
     x = state{x + k * y};
-    p = estimate_uncertainty{(i - k) * p * t(i - k) + k * r * t(k)};
+    p = estimate_uncertainty{correct(i - k, p, k, r)};
   }
 
   constexpr void predict() { p = estimate_uncertainty{p + q}; }
@@ -0,0 +1,313 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_INTERNAL_X_Z_P_Q_R_FF_HH_EN_US_PS_HPP
+#define FCAROUGE_KALMAN_INTERNAL_X_Z_P_Q_R_FF_HH_EN_US_PS_HPP
+
+#include "function.hpp"
+#include "parallel.hpp"
+#include "sampling.hpp"
+#include "type.hpp"
+#include "utility.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <tuple>
+#include <vector>
+
+namespace fcarouge::kalman_internal {
+// Helper template to support multiple pack deduction.
+template <typename, typename, typename, typename, typename>
+struct x_z_p_q_r_ff_hh_en_us_ps final {};
+
+// The square root of a covariance drawing its correlated normal samples, in
+// place of the covariance. A diagonal covariance keeps its variances and
+// scales the standard normal samples by their square roots. The lower
+// triangular factor of a covariance with off-diagonal elements is kept on the
+// heap.
+template <typename Vector> struct normal_root {
+  using covariance = ᴀʙᵀ<Vector, Vector>;
+
+  static constexpr std::size_t size{dimension<Vector>};
+
+  Vector variances{zero<Vector>};
+  Vector deviations{zero<Vector>};
+  std::unique_ptr<covariance> lower{};
+
+  constexpr void factorize(const covariance &value) {
+    auto copy{std::make_unique<covariance>(value)};
+    bool diagonal{true};
+    for (std::size_t index{0}; index < size * size; ++index) {
+      if (index % (size + 1) != 0 && element(*copy, index) != 0) {
+        diagonal = false;
+      }
+    }
+
+    if (diagonal) {
+      using std::sqrt;
+      for (std::size_t index{0}; index < size; ++index) {
+        element(variances, index) = element(*copy, index * (size + 1));
+        element(deviations, index) = sqrt(element(variances, index));
+      }
+      lower.reset();
+    } else {
+      *copy = factor(value);
+      lower = std::move(copy);
+    }
+  }
+
+  template <typename Engine>
+  [[nodiscard]] constexpr auto draw(Engine &engine) const -> Vector {
+    if (lower) {
+      return Vector{*lower * normal<Vector>(engine)};
+    }
+
+    Vector sample{normal<Vector>(engine)};
+    Vector scales{deviations};
+    for (std::size_t index{0}; index < size; ++index) {
+      element(sample, index) *= element(scales, index);
+    }
+    return sample;
+  }
+
+  [[nodiscard]] constexpr auto value() const -> covariance {
+    if (lower) {
+      return covariance{*lower * t(*lower)};
+    }
+
+    covariance result{zero<covariance>};
+    Vector diagonal{variances};
+    for (std::size_t index{0}; index < size; ++index) {
+      element(result, index * (size + 1)) = element(diagonal, index);
+    }
+    return result;
+  }
+};
+
+// The estimate uncertainty is represented by the ensemble members, on the
+// heap. It is only computed on demand, from the member anomalies, and setting
+// it samples the members anew. The gain is computed from the anomalies and
+// their projections in the output space, such that no state by state matrix is
+// ever stored or computed by the steps. The process uncertainty is only kept
+// by its variances or its factor, a diagonal uncertainty costs a scaling per
+// member.
+//! @todo Support the deterministic square root analysis?
+template <typename State, typename Output, typename Type, std::size_t Size,
+          typename... UpdateTypes, typename... PredictionTypes>
+struct x_z_p_q_r_ff_hh_en_us_ps<State, Output, ensemble_t<Type, Size>,
+                                std::tuple<UpdateTypes...>,
+                                std::tuple<PredictionTypes...>> {
+  static_assert(Size > 1, "The ensemble requires at least two members.");
+
+  using state = State;
+  using output = Output;
+  using estimate_uncertainty = ᴀʙᵀ<state, state>;
+  using process_uncertainty = ᴀʙᵀ<state, state>;
+  using output_uncertainty = ᴀʙᵀ<output, output>;
+  using innovation = output;
+  using innovation_uncertainty = output_uncertainty;
+  using cross_uncertainty = ᴀʙᵀ<state, output>;
+  using transition_function =
+      function<state(const state &, const PredictionTypes &...)>;
+  using observation_function =
+      function<output(const state &, const UpdateTypes &...)>;
+  using update_types = std::tuple<UpdateTypes...>;
+  using prediction_types = std::tuple<PredictionTypes...>;
+  using gain = evaluate<quotient<state, innovation>>;
+  using random_engine = std::mt19937_64;
+
+  static constexpr Type scale{Type{1} / static_cast<Type>(Size - 1)};
+
+  state mean{zero<state>};
+  normal_root<state> process_root{};
+  output_uncertainty noise{zero<output_uncertainty>};
+  normal_root<output> noise_root{};
+  transition_function transition{
+      [](const state &state_x,
+         [[maybe_unused]] const auto &...arguments) -> state {
+        return state_x;
+      }};
+  observation_function observation{
+      []([[maybe_unused]] const state &state_x,
+         [[maybe_unused]] const auto &...arguments) -> output {
+        return zero<output>;
+      }};
+  random_engine engine{};
+  gain k{one<gain>};
+  innovation y{zero<innovation>};
+  innovation_uncertainty s{one<innovation_uncertainty>};
+  output z{zero<output>};
+  update_types update_arguments{};
+  prediction_types prediction_arguments{};
+
+  // Without an estimate uncertainty, the members are sampled on the first step
+  // from the estimate and an identity uncertainty.
+  std::vector<state> members = std::vector<state>(Size);
+  std::vector<output> observed = std::vector<output>(Size);
+  bool sampled{false};
+
+  [[nodiscard]] constexpr auto x() const -> const state & { return mean; }
+
+  constexpr void x(const state &value) {
+    if (sampled) {
+      for (state &member : members) {
+        member = state{member + value - mean};
+      }
+    }
+    mean = value;
+  }
+
+  [[nodiscard]] constexpr auto p() const -> estimate_uncertainty {
+    if (!sampled) {
+      return one<estimate_uncertainty>;
+    }
+
+    estimate_uncertainty covariance{zero<estimate_uncertainty>};
+    for (const state &member : members) {
+      const state dx{member - mean};
+      covariance = estimate_uncertainty{covariance + dx * t(dx)};
+    }
+    return estimate_uncertainty{scale * covariance};
+  }
+
+  constexpr void p(const estimate_uncertainty &value) {
+    normal_root<state> root{};
+    root.factorize(value);
+    scatter([this, &root] { return root.draw(engine); });
+  }
+
+  [[nodiscard]] constexpr auto q() const -> process_uncertainty {
+    return process_root.value();
+  }
+
+  constexpr void q(const process_uncertainty &value) {
+    process_root.factorize(value);
+  }
+
+  [[nodiscard]] constexpr auto r() const -> const output_uncertainty & {
+    return noise;
+  }
+
+  constexpr void r(const output_uncertainty &value) {
+    noise = value;
+    noise_root.factorize(value);
+  }
+
+  constexpr void update(const UpdateTypes &...update_pack, const auto &output_z,
+                        const auto &...outputs_z) {
+    sample();
+    update_arguments = {update_pack...};
+    z = output{output_z, outputs_z...};
+    for_parallel(Size, [this, &update_pack...](std::size_t index) {
+      observed[index] = observation(members[index], update_pack...);
+    });
+
+    const output predicted_z{average(observed)};
+    innovation_uncertainty spread{zero<innovation_uncertainty>};
+    cross_uncertainty pxz{zero<cross_uncertainty>};
+    for (std::size_t index{0}; index < Size; ++index) {
+      const state dx{members[index] - mean};
+      const output dz{observed[index] - predicted_z};
+      spread = innovation_uncertainty{spread + dz * t(dz)};
+      pxz = cross_uncertainty{pxz + dx * t(dz)};
+    }
+
+    s = innovation_uncertainty{scale * spread + noise};
+    k = cross_uncertainty{scale * pxz} / s;
+    y = z - predicted_z;
+
+    for (std::size_t index{0}; index < Size; ++index) {
+      const output perturbed_z{z + noise_root.draw(engine)};
+      members[index] =
+          state{members[index] + k * (perturbed_z - observed[index])};
+    }
+
+    mean = average(members);
+  }
+
+  constexpr void predict(const PredictionTypes &...prediction_pack) {
+    sample();
+    prediction_arguments = {prediction_pack...};
+    for_parallel(Size, [this, &prediction_pack...](std::size_t index) {
+      members[index] = transition(members[index], prediction_pack...);
+    });
+
+    for (state &member : members) {
+      member = state{member + process_root.draw(engine)};
+    }
+
+    mean = average(members);
+  }
+
+  // Draws the members from the estimate and an identity uncertainty when no
+  // estimate uncertainty sampled them.
+  constexpr void sample() {
+    if (!sampled) {
+      scatter([this] { return normal<state>(engine); });
+    }
+  }
+
+  // Draws the members from the estimate and the deviations, centered on the
+  // estimate.
+  template <typename Draw> constexpr void scatter(Draw draw) {
+    for (state &member : members) {
+      member = state{mean + draw()};
+    }
+
+    const state offset{mean - average(members)};
+    for (state &member : members) {
+      member = state{member + offset};
+    }
+    sampled = true;
+  }
+
+  template <typename Value>
+  [[nodiscard]] static constexpr auto average(const std::vector<Value> &values)
+      -> Value {
+    Value result{zero<Value>};
+    for (const Value &value : values) {
+      result = Value{result + value};
+    }
+    return Value{result / static_cast<Type>(Size)};
+  }
+};
+} // namespace fcarouge::kalman_internal
+
+#endif // FCAROUGE_KALMAN_INTERNAL_X_Z_P_Q_R_FF_HH_EN_US_PS_HPP
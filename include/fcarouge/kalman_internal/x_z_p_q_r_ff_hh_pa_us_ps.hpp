@@ -0,0 +1,380 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_INTERNAL_X_Z_P_Q_R_FF_HH_PA_US_PS_HPP
+#define FCAROUGE_KALMAN_INTERNAL_X_Z_P_Q_R_FF_HH_PA_US_PS_HPP
+
+#include "function.hpp"
+#include "parallel.hpp"
+#include "sampling.hpp"
+#include "type.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace fcarouge::kalman_internal {
+// A counter-based pseudo-random bit generator. Each particle of each step draws
+// from its own stream, reproducible regardless of the threads scheduling.
+struct counter_engine {
+  using result_type = std::uint64_t;
+
+  std::uint64_t state;
+
+  constexpr counter_engine(std::uint64_t seed, std::uint64_t stream,
+                           std::uint64_t index)
+      : state{seed ^ mix(stream * 0x9E3779B97F4A7C15U + index)} {}
+
+  [[nodiscard]] static constexpr auto min() -> result_type { return 0; }
+
+  [[nodiscard]] static constexpr auto max() -> result_type {
+    return ~result_type{0};
+  }
+
+  constexpr auto operator()() -> result_type {
+    state += 0x9E3779B97F4A7C15U;
+    return mix(state);
+  }
+
+  // The SplitMix64 finalizer.
+  [[nodiscard]] static constexpr auto mix(std::uint64_t value)
+      -> std::uint64_t {
+    value = (value ^ (value >> 30U)) * 0xBF58476D1CE4E5B9U;
+    value = (value ^ (value >> 27U)) * 0x94D049BB133111EBU;
+    return value ^ (value >> 31U);
+  }
+};
+
+// Helper template to support multiple pack deduction.
+template <typename, typename, typename, typename, typename>
+struct x_z_p_q_r_ff_hh_pa_us_ps final {};
+
+// The bootstrap particle filter, or sequential importance resampling filter.
+// The particles are stored as a structure of arrays: one contiguous array of
+// all the particles per state element. The storage is allocated on the first
+// step, the steps do not allocate. The estimate uncertainty is only computed on
+// demand. The weighted particles are only resampled when their effective sample
+// size falls below the threshold, resampling otherwise only adds noise. An
+// update no particle explains, of all zero or undefined likelihoods, carries no
+// information and leaves the particles equally weighted.
+template <typename State, typename Output, typename Type,
+          typename... UpdateTypes, typename... PredictionTypes>
+struct x_z_p_q_r_ff_hh_pa_us_ps<State, Output, particles<Type>,
+                                std::tuple<UpdateTypes...>,
+                                std::tuple<PredictionTypes...>> {
+  using state = State;
+  using output = Output;
+  using estimate_uncertainty = ᴀʙᵀ<state, state>;
+  using process_uncertainty = ᴀʙᵀ<state, state>;
+  using output_uncertainty = ᴀʙᵀ<output, output>;
+  using distance = evaluate<product<evaluate<transpose<output>>, output>>;
+  using transition_function =
+      function<state(const state &, const PredictionTypes &...)>;
+  using observation_function =
+      function<output(const state &, const UpdateTypes &...)>;
+  using update_types = std::tuple<UpdateTypes...>;
+  using prediction_types = std::tuple<PredictionTypes...>;
+
+  static constexpr std::size_t size{dimension<state>};
+
+  state mean{zero<state>};
+  mutable estimate_uncertainty covariance{one<estimate_uncertainty>};
+  process_uncertainty process{zero<process_uncertainty>};
+  output_uncertainty noise{one<output_uncertainty>};
+  transition_function transition{
+      [](const state &state_x,
+         [[maybe_unused]] const auto &...arguments) -> state {
+        return state_x;
+      }};
+  observation_function observation{
+      []([[maybe_unused]] const state &state_x,
+         [[maybe_unused]] const auto &...arguments) -> output {
+        return zero<output>;
+      }};
+  particles<Type> parameters{};
+  output z{zero<output>};
+  update_types update_arguments{};
+  prediction_types prediction_arguments{};
+
+  // The particles are sampled on the first step, from the estimate and its
+  // uncertainty. Setting the estimate uncertainty samples the particles anew.
+  std::vector<Type> store{};
+  std::vector<Type> resampled{};
+  std::vector<Type> log_weights{};
+  std::vector<Type> weights{};
+  std::vector<std::size_t> ancestors{};
+  std::uint64_t streams{0};
+  bool sampled{false};
+  mutable bool stale{false};
+  // The process uncertainty is factored, and the output uncertainty inverted,
+  // on the first step following their change.
+  process_uncertainty lq{zero<process_uncertainty>};
+  output_uncertainty information{one<output_uncertainty>};
+  bool factored{false};
+  bool inverted{false};
+
+  [[nodiscard]] constexpr auto x() const -> const state & { return mean; }
+
+  constexpr void x(const state &value) {
+    if (sampled) {
+      for (std::size_t row{0}; row < size; ++row) {
+        const Type offset{element(value, row) - element(mean, row)};
+        for (std::size_t index{0}; index < parameters.count; ++index) {
+          store[row * parameters.count + index] += offset;
+        }
+      }
+    }
+    mean = value;
+  }
+
+  // The unbiased weighted covariance of the particles, reducing to the sample
+  // covariance of equally weighted particles. A single particle, or all the
+  // weight on one particle, has no spread and no bias correction.
+  [[nodiscard]] constexpr auto p() const -> const estimate_uncertainty & {
+    if (stale) {
+      covariance = zero<estimate_uncertainty>;
+      Type squares{0};
+      for (std::size_t index{0}; index < parameters.count; ++index) {
+        const state dx{load(index) - mean};
+        covariance =
+            estimate_uncertainty{covariance + weights[index] * dx * t(dx)};
+        squares += weights[index] * weights[index];
+      }
+      if (squares < Type{1}) {
+        covariance = estimate_uncertainty{covariance / (Type{1} - squares)};
+      }
+      stale = false;
+    }
+    return covariance;
+  }
+
+  constexpr void p(const estimate_uncertainty &value) {
+    covariance = value;
+    stale = false;
+    sampled = false;
+  }
+
+  [[nodiscard]] constexpr auto q() const -> const process_uncertainty & {
+    return process;
+  }
+
+  constexpr void q(const process_uncertainty &value) {
+    process = value;
+    factored = false;
+  }
+
+  [[nodiscard]] constexpr auto r() const -> const output_uncertainty & {
+    return noise;
+  }
+
+  constexpr void r(const output_uncertainty &value) {
+    noise = value;
+    inverted = false;
+  }
+
+  constexpr void update(const UpdateTypes &...update_pack, const auto &output_z,
+                        const auto &...outputs_z) {
+    sample();
+    update_arguments = {update_pack...};
+    z = output{output_z, outputs_z...};
+    if (!inverted) {
+      information = one<output_uncertainty> / noise;
+      inverted = true;
+    }
+
+    for_parallel(parameters.count, [this, &update_pack...](std::size_t index) {
+      const output innovation{z - observation(load(index), update_pack...)};
+      distance squared{t(innovation) * information * innovation};
+      log_weights[index] -= Type{0.5} * element(squared, 0);
+    });
+
+    normalize();
+    if (effective() <
+        parameters.threshold * static_cast<Type>(parameters.count)) {
+      resample();
+    }
+    mean = average();
+    stale = true;
+  }
+
+  constexpr void predict(const PredictionTypes &...prediction_pack) {
+    sample();
+    prediction_arguments = {prediction_pack...};
+    if (!factored) {
+      lq = factor(process);
+      factored = true;
+    }
+
+    const std::uint64_t stream{streams++};
+    for_parallel(parameters.count, [this, stream, &prediction_pack...](
+                                       std::size_t index) {
+      counter_engine engine{parameters.seed, stream, index};
+      persist(index, state{transition(load(index), prediction_pack...) +
+                           lq * normal<state>(engine)});
+    });
+
+    mean = average();
+    stale = true;
+  }
+
+  // Draws the equally weighted particles from the estimate and its
+  // uncertainty.
+  constexpr void sample() {
+    if (sampled) {
+      return;
+    }
+
+    store.resize(size * parameters.count);
+    resampled.resize(size * parameters.count);
+    log_weights.assign(parameters.count, Type{0});
+    weights.assign(parameters.count,
+                   Type{1} / static_cast<Type>(parameters.count));
+    ancestors.resize(parameters.count);
+
+    const estimate_uncertainty l{factor(covariance)};
+    const std::uint64_t stream{streams++};
+    for_parallel(parameters.count, [this, &l, stream](std::size_t index) {
+      counter_engine engine{parameters.seed, stream, index};
+      persist(index, state{mean + l * normal<state>(engine)});
+    });
+    sampled = true;
+  }
+
+  // Normalizes the weights from their logarithms, rebased on their maximum
+  // against the underflow over successive updates. Undefined logarithms are
+  // null weights. Without any non-null weight, the weights are equal.
+  constexpr void normalize() {
+    Type maximum{-std::numeric_limits<Type>::infinity()};
+    for (Type &log_weight : log_weights) {
+      if (std::isnan(log_weight)) {
+        log_weight = -std::numeric_limits<Type>::infinity();
+      }
+      maximum = std::max(maximum, log_weight);
+    }
+
+    if (!std::isfinite(maximum)) {
+      std::ranges::fill(log_weights, Type{0});
+      std::ranges::fill(weights,
+                        Type{1} / static_cast<Type>(parameters.count));
+      return;
+    }
+
+    Type total{0};
+    for (std::size_t index{0}; index < parameters.count; ++index) {
+      log_weights[index] -= maximum;
+      weights[index] = std::exp(log_weights[index]);
+      total += weights[index];
+    }
+    for (Type &weight : weights) {
+      weight /= total;
+    }
+  }
+
+  // The effective sample size `1 / Σ wᵢ²` of the normalized weights.
+  [[nodiscard]] constexpr auto effective() const -> Type {
+    Type squares{0};
+    for (const Type &weight : weights) {
+      squares += weight * weight;
+    }
+    return Type{1} / squares;
+  }
+
+  // Systematic resampling of linear complexity: a single comb of equally
+  // spaced teeth walks the cumulated normalized weights.
+  constexpr void resample() {
+    counter_engine engine{parameters.seed, streams++, 0};
+    const Type stride{Type{1} / static_cast<Type>(parameters.count)};
+    Type tooth{std::uniform_real_distribution<Type>{Type{0}, stride}(engine)};
+    Type cumulated{weights[0]};
+    std::size_t source{0};
+    for (std::size_t index{0}; index < parameters.count; ++index) {
+      while (tooth > cumulated && source + 1 < parameters.count) {
+        cumulated += weights[++source];
+      }
+      ancestors[index] = source;
+      tooth += stride;
+    }
+
+    for_parallel(parameters.count, [this](std::size_t index) {
+      for (std::size_t row{0}; row < size; ++row) {
+        resampled[row * parameters.count + index] =
+            store[row * parameters.count + ancestors[index]];
+      }
+    });
+    std::ranges::swap(store, resampled);
+    std::ranges::fill(log_weights, Type{0});
+    std::ranges::fill(weights, Type{1} / static_cast<Type>(parameters.count));
+  }
+
+  [[nodiscard]] constexpr auto load(std::size_t index) const -> state {
+    state value{mean};
+    for (std::size_t row{0}; row < size; ++row) {
+      element(value, row) = store[row * parameters.count + index];
+    }
+    return value;
+  }
+
+  constexpr void persist(std::size_t index, const state &value) {
+    for (std::size_t row{0}; row < size; ++row) {
+      store[row * parameters.count + index] = element(value, row);
+    }
+  }
+
+  // The element-wise weighted mean of the particles, over contiguous arrays.
+  [[nodiscard]] constexpr auto average() const -> state {
+    state value{mean};
+    for (std::size_t row{0}; row < size; ++row) {
+      Type sum{0};
+      for (std::size_t index{0}; index < parameters.count; ++index) {
+        sum += weights[index] * store[row * parameters.count + index];
+      }
+      element(value, row) = sum;
+    }
+    return value;
+  }
+};
+} // namespace fcarouge::kalman_internal
+
+#endif // FCAROUGE_KALMAN_INTERNAL_X_Z_P_Q_R_FF_HH_PA_US_PS_HPP
@@ -0,0 +1,301 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_INTERNAL_X_Z_P_Q_R_FF_HH_SP_US_PS_HPP
+#define FCAROUGE_KALMAN_INTERNAL_X_Z_P_Q_R_FF_HH_SP_US_PS_HPP
+
+#include "function.hpp"
+#include "sampling.hpp"
+#include "type.hpp"
+#include "utility.hpp"
+
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+
+namespace fcarouge::kalman_internal {
+// A callable evaluating all the points at once, as opposed to one point. The
+// callable may return an unevaluated expression of the points.
+template <typename Callable, typename Result, typename... Arguments>
+concept batched =
+    std::invocable<Callable, Arguments...> &&
+    std::same_as<evaluate<std::remove_cvref_t<
+                     std::invoke_result_t<Callable, Arguments...>>>,
+                 Result>;
+
+// The sampling rule selects the points, their spread, and their weights.
+template <typename Points, std::size_t Dimension> struct sigma_rule;
+
+// The scaled unscented transform of 2n + 1 symmetric sigma points.
+template <typename Type, std::size_t Dimension>
+struct sigma_rule<sigma_points<Type>, Dimension> {
+  static constexpr std::size_t centers{1};
+  static constexpr std::size_t count{2 * Dimension + centers};
+
+  Type spread;
+  Type center_mean_weight;
+  Type center_covariance_weight;
+  Type weight;
+
+  constexpr explicit sigma_rule(const sigma_points<Type> &points) {
+    const Type n{static_cast<Type>(Dimension)};
+    const Type lambda{points.alpha * points.alpha * (n + points.kappa) - n};
+
+    spread = std::sqrt(n + lambda);
+    center_mean_weight = lambda / (n + lambda);
+    center_covariance_weight = center_mean_weight + Type{1} -
+                               points.alpha * points.alpha + points.beta;
+    weight = Type{1} / (Type{2} * (n + lambda));
+  }
+
+  [[nodiscard]] constexpr auto mean_weight(std::size_t index) const -> Type {
+    return index ? weight : center_mean_weight;
+  }
+
+  [[nodiscard]] constexpr auto covariance_weight(std::size_t index) const
+      -> Type {
+    return index ? weight : center_covariance_weight;
+  }
+};
+
+// The third-degree spherical-radial cubature of 2n equally weighted symmetric
+// points.
+template <typename Type, std::size_t Dimension>
+struct sigma_rule<cubature_points_t<Type>, Dimension> {
+  static constexpr std::size_t centers{0};
+  static constexpr std::size_t count{2 * Dimension};
+
+  Type spread{std::sqrt(static_cast<Type>(Dimension))};
+  Type weight{Type{1} / static_cast<Type>(count)};
+
+  constexpr explicit sigma_rule(
+      [[maybe_unused]] const cubature_points_t<Type> &points) {}
+
+  [[nodiscard]] constexpr auto
+  mean_weight([[maybe_unused]] std::size_t index) const -> Type {
+    return weight;
+  }
+
+  [[nodiscard]] constexpr auto
+  covariance_weight([[maybe_unused]] std::size_t index) const -> Type {
+    return weight;
+  }
+};
+
+// Helper template to support multiple pack deduction.
+template <typename, typename, typename, typename, typename>
+struct x_z_p_q_r_ff_hh_sp_us_ps final {};
+
+//! @todo Support the augmented state for non-additive noises?
+template <typename State, typename Output, typename Points,
+          typename... UpdateTypes, typename... PredictionTypes>
+struct x_z_p_q_r_ff_hh_sp_us_ps<State, Output, Points,
+                                std::tuple<UpdateTypes...>,
+                                std::tuple<PredictionTypes...>> {
+  using state = State;
+  using output = Output;
+  using estimate_uncertainty = ᴀʙᵀ<state, state>;
+  using process_uncertainty = ᴀʙᵀ<state, state>;
+  using output_uncertainty = ᴀʙᵀ<output, output>;
+  using innovation = output;
+  using innovation_uncertainty = output_uncertainty;
+  using cross_uncertainty = ᴀʙᵀ<state, output>;
+  using rule = sigma_rule<Points, dimension<state>>;
+  using state_points = juxtapose<state, rule::count>;
+  using output_points = juxtapose<output, rule::count>;
+  using transition_function =
+      function<state_points(const state_points &, const PredictionTypes &...)>;
+  using observation_function =
+      function<output_points(const state_points &, const UpdateTypes &...)>;
+  using update_types = std::tuple<UpdateTypes...>;
+  using prediction_types = std::tuple<PredictionTypes...>;
+  using gain = evaluate<quotient<state, innovation>>;
+
+  state x{zero<state>};
+  estimate_uncertainty covariance{one<estimate_uncertainty>};
+  process_uncertainty q{zero<process_uncertainty>};
+  output_uncertainty r{zero<output_uncertainty>};
+  transition_function transition{
+      [](const state_points &sigma_x,
+         [[maybe_unused]] const auto &...arguments) -> state_points {
+        return sigma_x;
+      }};
+  observation_function observation{
+      []([[maybe_unused]] const state_points &sigma_x,
+         [[maybe_unused]] const auto &...arguments) -> output_points {
+        return output_points{};
+      }};
+  rule points{Points{}};
+  gain k{one<gain>};
+  innovation y{zero<innovation>};
+  innovation_uncertainty s{one<innovation_uncertainty>};
+  output z{zero<output>};
+  update_types update_arguments{};
+  prediction_types prediction_arguments{};
+
+  // The factor of the estimate uncertainty is valid until the estimate
+  // uncertainty changes by a prediction or by its setter. The update downdates
+  // the factor such that the next prediction draws its sigma points without a
+  // new factorization.
+  estimate_uncertainty l{one<estimate_uncertainty>};
+  bool factored{false};
+  state_points sigma{};
+  output_points observed{};
+
+  [[nodiscard]] constexpr auto p() const -> const estimate_uncertainty & {
+    return covariance;
+  }
+
+  constexpr void p(const estimate_uncertainty &value) {
+    covariance = value;
+    factored = false;
+  }
+
+  // Evaluates the callable of one point on each point, in a single call of the
+  // type-erased function.
+  template <typename Result, typename Callable>
+  [[nodiscard]] static constexpr auto batch(Callable callable) {
+    return [callable](const state_points &sigma_x,
+                      const auto &...arguments) -> Result {
+      Result result{};
+      for (std::size_t index{0}; index < rule::count; ++index) {
+        column(result, index) =
+            std::invoke(callable, state{column(sigma_x, index)}, arguments...);
+      }
+      return result;
+    };
+  }
+
+  template <typename Callable>
+  [[nodiscard]] static constexpr auto batch_transition(Callable callable)
+      -> transition_function {
+    if constexpr (batched<Callable, state_points, const state_points &,
+                          const PredictionTypes &...>) {
+      return transition_function{callable};
+    } else {
+      return transition_function{batch<state_points>(callable)};
+    }
+  }
+
+  template <typename Callable>
+  [[nodiscard]] static constexpr auto batch_observation(Callable callable)
+      -> observation_function {
+    if constexpr (batched<Callable, output_points, const state_points &,
+                          const UpdateTypes &...>) {
+      return observation_function{callable};
+    } else {
+      return observation_function{batch<output_points>(callable)};
+    }
+  }
+
+  constexpr void update(const UpdateTypes &...update_pack, const auto &output_z,
+                        const auto &...outputs_z) {
+    update_arguments = {update_pack...};
+    z = output{output_z, outputs_z...};
+    sample();
+    observed = observation(sigma, update_pack...);
+
+    output predicted_z{zero<output>};
+    for (std::size_t index{0}; index < rule::count; ++index) {
+      predicted_z = output{predicted_z + points.mean_weight(index) *
+                                             column(observed, index)};
+    }
+
+    s = r;
+    cross_uncertainty pxz{zero<cross_uncertainty>};
+    for (std::size_t index{0}; index < rule::count; ++index) {
+      const state dx{column(sigma, index) - x};
+      const output dz{column(observed, index) - predicted_z};
+      s = innovation_uncertainty{s + points.covariance_weight(index) * dz *
+                                         t(dz)};
+      pxz = cross_uncertainty{pxz + points.covariance_weight(index) * dx *
+                                        t(dz)};
+    }
+
+    k = pxz / s;
+    y = z - predicted_z;
+    x = state{x + k * y};
+    covariance = estimate_uncertainty{covariance - k * s * t(k)};
+    l = downdate(l, gain{k * factor(s)});
+    factored = true;
+  }
+
+  constexpr void predict(const PredictionTypes &...prediction_pack) {
+    prediction_arguments = {prediction_pack...};
+    sample();
+    sigma = transition(sigma, prediction_pack...);
+
+    x = zero<state>;
+    for (std::size_t index{0}; index < rule::count; ++index) {
+      x = state{x + points.mean_weight(index) * column(sigma, index)};
+    }
+
+    covariance = q;
+    for (std::size_t index{0}; index < rule::count; ++index) {
+      const state dx{column(sigma, index) - x};
+      covariance = estimate_uncertainty{
+          covariance + points.covariance_weight(index) * dx * t(dx)};
+    }
+    factored = false;
+  }
+
+  // Draws the sigma points of the estimate, factoring the estimate uncertainty
+  // only when changed since its last factorization.
+  constexpr void sample() {
+    if (!factored) {
+      l = factor(covariance);
+      factored = true;
+    }
+
+    if constexpr (rule::centers) {
+      column(sigma, 0) = x;
+    }
+    for (std::size_t index{0}; index < dimension<state>; ++index) {
+      column(sigma, rule::centers + index) =
+          x + points.spread * column(l, index);
+      column(sigma, rule::centers + dimension<state> + index) =
+          x - points.spread * column(l, index);
+    }
+  }
+};
+} // namespace fcarouge::kalman_internal
+
+#endif // FCAROUGE_KALMAN_INTERNAL_X_Z_P_Q_R_FF_HH_SP_US_PS_HPP
@@ -70,15 +70,15 @@ template <typename State, typename Output> struct x_z_p_q_r_h_f {
   constexpr void update(const auto &output_z, const auto &...outputs_z) {
     z = output{output_z, outputs_z...};
     s = innovation_uncertainty{h * p * t(h) + r};
-    k = p * t(h) / s;
+    k = weigh(p, h, s);
     y = z - h * x;
     x = state{x + k * y};
-    p = estimate_uncertainty{(i - k * h) * p * t(i - k * h) + k * r * t(k)};
+    p = estimate_uncertainty{correct(i - k * h, p, k, r)};
   }
 
   constexpr void predict() {
     x = f * x;
-    p = estimate_uncertainty{f * p * t(f) + q};
+    p = estimate_uncertainty{propagate(f, p, q)};
   }
 };
 } // namespace fcarouge::kalman_internal
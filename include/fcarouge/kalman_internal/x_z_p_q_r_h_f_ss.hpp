@@ -0,0 +1,140 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_INTERNAL_X_Z_P_Q_R_H_F_SS_HPP
+#define FCAROUGE_KALMAN_INTERNAL_X_Z_P_Q_R_H_F_SS_HPP
+
+#include "function.hpp"
+#include "utility.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+
+namespace fcarouge::kalman_internal {
+// Helper template to support multiple pack deduction.
+template <typename, typename, typename...> struct x_z_p_q_r_h_f_ss final {};
+
+template <typename State, typename... PredictionTypes, typename... Sensors>
+struct x_z_p_q_r_h_f_ss<State, std::tuple<PredictionTypes...>, Sensors...> {
+  using state = State;
+  using estimate_uncertainty = ᴀʙᵀ<state, state>;
+  using process_uncertainty = ᴀʙᵀ<state, state>;
+  using state_transition = evaluate<quotient<state, state>>;
+  using transition_state_function =
+      function<state_transition(const PredictionTypes &...)>;
+  using prediction_types = std::tuple<PredictionTypes...>;
+
+  // The measurement model and the last update characteristics of a sensor,
+  // typed with the output dimension of the sensor.
+  template <typename Sensor> struct measurement {
+    using output = Sensor::output;
+    using output_uncertainty = ᴀʙᵀ<output, output>;
+    using output_model = evaluate<quotient<output, state>>;
+    using innovation = evaluate<difference<output, output>>;
+    using innovation_uncertainty = output_uncertainty;
+    using gain = evaluate<quotient<state, innovation>>;
+
+    static inline const auto i{one<evaluate<product<gain, output_model>>>};
+
+    constexpr explicit measurement(const Sensor &sensor)
+        : r{sensor.r}, h{sensor.h} {}
+
+    output_uncertainty r;
+    output_model h;
+    gain k{one<gain>};
+    innovation y{zero<innovation>};
+    innovation_uncertainty s{one<innovation_uncertainty>};
+    output z{zero<output>};
+  };
+
+  using measurements = std::tuple<measurement<Sensors>...>;
+
+  // The position of the named sensor in the declaration order.
+  template <typename Name>
+  static constexpr std::size_t position{[] {
+    std::size_t index{0};
+    for (bool named : {std::same_as<Name, typename Sensors::name>...}) {
+      if (named) {
+        break;
+      }
+      ++index;
+    }
+    return index;
+  }()};
+
+  state x{zero<state>};
+  estimate_uncertainty p{one<estimate_uncertainty>};
+  process_uncertainty q{zero<process_uncertainty>};
+  state_transition f{one<state_transition>};
+  measurements models;
+  // The state transition function of the prediction arguments, empty for a
+  // constant F.
+  transition_state_function transition_state_f{};
+  prediction_types prediction_arguments{};
+
+  template <typename Name>
+  constexpr void update(const auto &output_z, const auto &...outputs_z) {
+    static_assert(position<Name> < sizeof...(Sensors),
+                  "The named sensor is not declared by the filter.");
+
+    auto &model{std::get<position<Name>>(models)};
+    using model_type = std::tuple_element_t<position<Name>, measurements>;
+
+    model.z = typename model_type::output{output_z, outputs_z...};
+    model.s = typename model_type::innovation_uncertainty{
+        model.h * p * t(model.h) + model.r};
+    model.k = weigh(p, model.h, model.s);
+    model.y = model.z - model.h * x;
+    x = state{x + model.k * model.y};
+    p = estimate_uncertainty{
+        correct(model_type::i - model.k * model.h, p, model.k, model.r)};
+  }
+
+  constexpr void predict(const PredictionTypes &...prediction_pack) {
+    prediction_arguments = {prediction_pack...};
+    if (transition_state_f) {
+      f = transition_state_f(prediction_pack...);
+    }
+    x = f * x;
+    p = estimate_uncertainty{propagate(f, p, q)};
+  }
+};
+} // namespace fcarouge::kalman_internal
+
+#endif // FCAROUGE_KALMAN_INTERNAL_X_Z_P_Q_R_H_F_SS_HPP
@@ -40,8 +40,11 @@ For more information, please refer to <https://unlicense.org> */
 #define FCAROUGE_KALMAN_INTERNAL_X_Z_P_Q_R_HH_F_US_PS_HPP
 
 #include "function.hpp"
+#include "type.hpp"
 #include "utility.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <tuple>
 
 namespace fcarouge::kalman_internal {
@@ -68,9 +71,12 @@ struct x_z_p_q_r_hh_f_us_ps<State, Output, std::tuple<UpdateTypes...>,
       function<state(const state &, const PredictionTypes &...)>;
   using observation_function =
       function<output(const state &, const UpdateTypes &...)>;
+  using transition_state_function =
+      function<state_transition(const state &, const PredictionTypes &...)>;
   using update_types = std::tuple<UpdateTypes...>;
   using prediction_types = std::tuple<PredictionTypes...>;
   using gain = evaluate<quotient<state, innovation>>;
+  using iteration_parameters = iterations<scalar_of<state>>;
 
   static inline const auto i{one<evaluate<product<gain, output_model>>>};
 
@@ -92,6 +98,9 @@ struct x_z_p_q_r_hh_f_us_ps<State, Output, std::tuple<UpdateTypes...>,
                 [[maybe_unused]] const auto &...arguments) -> output {
         return hh * state_x;
       }};
+  iteration_parameters iterate{};
+  // The state transition Jacobian function, empty for a constant F.
+  transition_state_function transition_state_f{};
 
   output_model h{one<output_model>};
   state_transition f{one<state_transition>};
@@ -106,18 +115,40 @@ struct x_z_p_q_r_hh_f_us_ps<State, Output, std::tuple<UpdateTypes...>,
                         const auto &...outputs_z) {
     update_arguments = {update_pack...};
     z = output{output_z, outputs_z...};
-    h = observation_state_h(x, update_pack...);
-    s = innovation_uncertainty{h * p * t(h) + r};
-    k = p * t(h) / s;
-    y = z - observation(x, update_pack...);
-    x = state{x + k * y};
-    p = estimate_uncertainty{(i - k * h) * p * t(i - k * h) + k * r * t(k)};
+    // The iterated update relinearizes the observation around the updated
+    // estimate, a Gauss-Newton minimization from the prior estimate. The
+    // innovation uncertainty changes with each linearization: only the P * Hᵀ
+    // product is shared by the innovation uncertainty and the gain. At least
+    // one linearization refreshes the gain and the output model correcting the
+    // estimate uncertainty.
+    const state prior{x};
+    const std::size_t count{std::max(iterate.count, std::size_t{1})};
+    for (std::size_t iteration{0}; iteration < count; ++iteration) {
+      h = observation_state_h(x, update_pack...);
+      const ᴀʙᵀ<estimate_uncertainty, output_model> pht{p * t(h)};
+      s = innovation_uncertainty{h * pht + r};
+      k = pht / s;
+      y = z - observation(x, update_pack...);
+      if (iteration > 0) {
+        y = innovation{y - h * (prior - x)};
+      }
+      const state estimate{prior + k * y};
+      const state step{estimate - x};
+      x = estimate;
+      if (squared_norm(step) < iterate.tolerance * iterate.tolerance) {
+        break;
+      }
+    }
+    p = estimate_uncertainty{correct(i - k * h, p, k, r)};
   }
 
   constexpr void predict(const PredictionTypes &...prediction_pack) {
     prediction_arguments = {prediction_pack...};
+    if (transition_state_f) {
+      f = transition_state_f(x, prediction_pack...);
+    }
     x = transition(x, prediction_pack...);
-    p = estimate_uncertainty{f * p * t(f) + q};
+    p = estimate_uncertainty{propagate(f, p, q)};
   }
 };
 } // namespace fcarouge::kalman_internal
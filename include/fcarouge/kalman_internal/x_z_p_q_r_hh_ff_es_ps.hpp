@@ -0,0 +1,125 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_INTERNAL_X_Z_P_Q_R_HH_FF_ES_PS_HPP
+#define FCAROUGE_KALMAN_INTERNAL_X_Z_P_Q_R_HH_FF_ES_PS_HPP
+
+#include "function.hpp"
+#include "utility.hpp"
+
+#include <tuple>
+
+namespace fcarouge::kalman_internal {
+// Helper template to support multiple pack deduction.
+template <typename, typename, typename, typename, typename>
+struct x_z_p_q_r_hh_ff_es_ps final {};
+
+// The error-state extended filter. The nominal state may live on a manifold,
+// for example a unit quaternion attitude, propagated by the transition
+// function. The estimate uncertainty is the covariance of the minimal dimension
+// error state, propagated by the error state transition F linearized about the
+// nominal state. The update estimates the error, injects it in the nominal
+// state by retraction `x ⊞ δx`, and resets it to zero with the reset Jacobian
+// approximated by the identity. The innovation is the local difference `z ⊟ ẑ`
+// of the outputs.
+template <typename State, typename Error, typename Output, typename Innovation,
+          typename... PredictionTypes>
+struct x_z_p_q_r_hh_ff_es_ps<State, Error, Output, Innovation,
+                             std::tuple<PredictionTypes...>> {
+  using state = State;
+  using error = Error;
+  using output = Output;
+  using innovation = Innovation;
+  using estimate_uncertainty = ᴀʙᵀ<error, error>;
+  using process_uncertainty = ᴀʙᵀ<error, error>;
+  using output_uncertainty = ᴀʙᵀ<innovation, innovation>;
+  using state_transition = evaluate<quotient<error, error>>;
+  using output_model = evaluate<quotient<innovation, error>>;
+  using innovation_uncertainty = output_uncertainty;
+  using observation_state_function = function<output_model(const state &)>;
+  using transition_state_function =
+      function<state_transition(const state &, const PredictionTypes &...)>;
+  using transition_function =
+      function<state(const state &, const PredictionTypes &...)>;
+  using observation_function = function<output(const state &)>;
+  using retraction_function = function<state(const state &, const error &)>;
+  using local_function =
+      function<innovation(const output &, const output &)>;
+  using prediction_types = std::tuple<PredictionTypes...>;
+  using gain = evaluate<quotient<error, innovation>>;
+
+  static inline const auto i{one<evaluate<product<gain, output_model>>>};
+
+  state x;
+  estimate_uncertainty p{one<estimate_uncertainty>};
+  process_uncertainty q{zero<process_uncertainty>};
+  output_uncertainty r{zero<output_uncertainty>};
+  observation_state_function observation_state_h;
+  transition_state_function transition_state_f;
+  observation_function observation;
+  transition_function transition;
+  retraction_function retract;
+  local_function localize;
+  output_model h{one<output_model>};
+  state_transition f{one<state_transition>};
+  gain k{one<gain>};
+  innovation y{zero<innovation>};
+  innovation_uncertainty s{one<innovation_uncertainty>};
+  output z{observation(x)};
+  prediction_types prediction_arguments{};
+
+  constexpr void update(const auto &output_z, const auto &...outputs_z) {
+    z = output{output_z, outputs_z...};
+    h = observation_state_h(x);
+    s = innovation_uncertainty{h * p * t(h) + r};
+    k = weigh(p, h, s);
+    y = localize(z, observation(x));
+    x = retract(x, error{k * y});
+    p = estimate_uncertainty{correct(i - k * h, p, k, r)};
+  }
+
+  constexpr void predict(const PredictionTypes &...prediction_pack) {
+    prediction_arguments = {prediction_pack...};
+    f = transition_state_f(x, prediction_pack...);
+    x = transition(x, prediction_pack...);
+    p = estimate_uncertainty{propagate(f, p, q)};
+  }
+};
+} // namespace fcarouge::kalman_internal
+
+#endif // FCAROUGE_KALMAN_INTERNAL_X_Z_P_Q_R_HH_FF_ES_PS_HPP
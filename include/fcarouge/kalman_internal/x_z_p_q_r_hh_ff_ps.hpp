@@ -105,17 +105,17 @@ struct x_z_p_q_r_hh_ff_ps<State, Output, std::tuple<PredictionTypes...>> {
     z = output{output_z, outputs_z...};
     h = observation_state_h(x);
     s = innovation_uncertainty{h * p * t(h) + r};
-    k = p * t(h) / s;
+    k = weigh(p, h, s);
     y = z - observation(x);
     x = state{x + k * y};
-    p = estimate_uncertainty{(i - k * h) * p * t(i - k * h) + k * r * t(k)};
+    p = estimate_uncertainty{correct(i - k * h, p, k, r)};
   }
 
   constexpr void predict(const PredictionTypes &...prediction_pack) {
     prediction_arguments = {prediction_pack...};
     f = transition_state_f(prediction_pack...);
     x = transition(x, prediction_pack...);
-    p = estimate_uncertainty{f * p * t(f) + q};
+    p = estimate_uncertainty{propagate(f, p, q)};
   }
 };
 } // namespace fcarouge::kalman_internal
@@ -80,16 +80,16 @@ template <typename State, typename Output> struct x_z_p_qq_rr_f {
     z = output{output_z, outputs_z...};
     r = noise_observation_r(x, z);
     s = innovation_uncertainty{h * p * t(h) + r};
-    k = p * t(h) / s;
+    k = weigh(p, h, s);
     y = z - h * x;
     x = state{x + k * y};
-    p = estimate_uncertainty{(i - k * h) * p * t(i - k * h) + k * r * t(k)};
+    p = estimate_uncertainty{correct(i - k * h, p, k, r)};
   }
 
   constexpr void predict() {
     q = noise_process_q(x);
     x = f * x;
-    p = estimate_uncertainty{f * p * t(f) + q};
+    p = estimate_uncertainty{propagate(f, p, q)};
   }
 };
 } // namespace fcarouge::kalman_internal
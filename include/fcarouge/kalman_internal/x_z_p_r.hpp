@@ -67,7 +67,7 @@ template <typename Type> struct x_z_p_r {
     k = p / s;
     y = z - x;
     x = x + k * y;
-    p = (i - k) * p * t(i - k) + k * r * t(k);
+    p = correct(i - k, p, k, r);
   }
 };
 } // namespace fcarouge::kalman_internal
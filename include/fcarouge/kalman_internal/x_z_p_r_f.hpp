@@ -69,7 +69,7 @@ template <typename State> struct x_z_p_r_f {
     k = p / s;
     y = z - x;
     x = x + k * y;
-    p = (i - k) * p * t(i - k) + k * r * t(k);
+    p = correct(i - k, p, k, r);
   }
 
   constexpr void predict() {
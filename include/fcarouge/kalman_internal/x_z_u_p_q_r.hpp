@@ -74,7 +74,7 @@ template <typename Type> struct x_z_u_p_q_r {
     k = p / s;
     y = z - x;
     x = x + k * y;
-    p = (i - k) * p * t(i - k) + k * r * t(k);
+    p = correct(i - k, p, k, r);
   }
 
   constexpr void predict(const auto &input_u, const auto &...inputs_u) {
@@ -90,10 +90,10 @@ struct x_z_u_p_q_r_h_f_g_us_ps<State, Output, Input, std::tuple<UpdateTypes...>,
     update_arguments = {update_pack...};
     z = output{output_z, outputs_z...};
     s = h * p * t(h) + r;
-    k = p * t(h) / s;
+    k = weigh(p, h, s);
     y = z - h * x;
     x = x + k * y;
-    p = (i - k * h) * p * t(i - k * h) + k * r * t(k);
+    p = correct(i - k * h, p, k, r);
   }
 
   //! @todo Add convertible requirements on input and output packs?
@@ -102,7 +102,7 @@ struct x_z_u_p_q_r_h_f_g_us_ps<State, Output, Input, std::tuple<UpdateTypes...>,
     prediction_arguments = {prediction_pack...};
     u = input{input_u, inputs_u...};
     x = f * x + g * u;
-    p = f * p * t(f) + q;
+    p = propagate(f, p, q);
   }
 };
 } // namespace fcarouge::kalman_internal
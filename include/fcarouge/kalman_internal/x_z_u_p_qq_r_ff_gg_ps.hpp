@@ -105,10 +105,10 @@ struct x_z_u_p_qq_r_ff_gg_ps<State, Output, Input, std::tuple<UpdateTypes...>,
   constexpr void update(const auto &output_z, const auto &...outputs_z) {
     z = output{output_z, outputs_z...};
     s = h * p * t(h) + r;
-    k = p * t(h) / s;
+    k = weigh(p, h, s);
     y = z - h * x;
     x = state{x + k * y};
-    p = estimate_uncertainty{(i - k * h) * p * t(i - k * h) + k * r * t(k)};
+    p = estimate_uncertainty{correct(i - k * h, p, k, r)};
   }
 
   constexpr void predict(const PredictionTypes &...prediction_pack,
@@ -119,7 +119,7 @@ struct x_z_u_p_qq_r_ff_gg_ps<State, Output, Input, std::tuple<UpdateTypes...>,
     q = noise_process_q(x, prediction_pack...);
     g = transition_control_g(prediction_pack...);
     x = f * x + g * u;
-    p = estimate_uncertainty{f * p * t(f) + q};
+    p = estimate_uncertainty{propagate(f, p, q)};
   }
 };
 } // namespace fcarouge::kalman_internal
@@ -0,0 +1,73 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_OOSM_HPP
+#define FCAROUGE_KALMAN_OOSM_HPP
+
+//! @file
+//! @brief The out-of-sequence measurement filter.
+//!
+//! @details Provides the rollback and replay of the late measurements of a
+//! filter. Include with the header of the filter.
+
+#include "kalman_internal/oosm.hpp"
+
+namespace fcarouge {
+//! @name Estimators
+//! @{
+
+//! @brief Out-of-sequence measurement filter.
+//!
+//! @details Keeps a bounded time-indexed history of the events of a filter,
+//! and rolls back and replays the history on late measurements. Declared from
+//! the filter and the history length, for example `oosm delayed{filter,
+//! horizon<64>}`.
+using kalman_internal::oosm;
+
+//! @brief History length value wrapper for out-of-sequence filter declaration
+//! support.
+using kalman_internal::horizon;
+
+//! @brief History length type wrapper for out-of-sequence filter declaration
+//! support.
+using kalman_internal::horizon_t;
+
+//! @}
+} // namespace fcarouge
+
+#endif // FCAROUGE_KALMAN_OOSM_HPP
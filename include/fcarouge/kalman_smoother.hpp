@@ -0,0 +1,84 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_SMOOTHER_HPP
+#define FCAROUGE_KALMAN_SMOOTHER_HPP
+
+//! @file
+//! @brief The fixed-interval and fixed-lag smoothers.
+//!
+//! @details Provides the Rauch-Tung-Striebel smoother with its in memory
+//! history, and the fixed-lag smoother. Include with the header of the smoothed
+//! filter. The memory-mapped file history has its own header.
+
+#include "kalman_internal/fixed_lag.hpp"
+#include "kalman_internal/history.hpp"
+#include "kalman_internal/rts.hpp"
+
+namespace fcarouge {
+//! @name Estimators
+//! @{
+
+//! @brief Rauch-Tung-Striebel fixed-interval smoother of a linear filter.
+//!
+//! @details Records the predictions of the forward filtering in a compact
+//! history, and produces the smoothed estimates in a backward pass. Declared
+//! from the filter to smooth.
+using kalman_internal::rts;
+
+//! @brief In memory history storage of the smoothers.
+using kalman_internal::memory_history;
+
+//! @brief Fixed-lag smoother of a linear filter.
+//!
+//! @details Keeps a ring buffer of the last estimates corrected by each update
+//! and provides the lag smoothed estimate at every step. Declared from the
+//! filter to smooth and the lag, for example `fixed_lag smoother{filter,
+//! lag<10>}`.
+using kalman_internal::fixed_lag;
+
+//! @brief Lag value wrapper for fixed-lag smoother declaration support.
+using kalman_internal::lag;
+
+//! @brief Lag type wrapper for fixed-lag smoother declaration support.
+using kalman_internal::lag_t;
+
+//! @}
+} // namespace fcarouge
+
+#endif // FCAROUGE_KALMAN_SMOOTHER_HPP
@@ -0,0 +1,72 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KALMAN_STATISTICS_HPP
+#define FCAROUGE_KALMAN_STATISTICS_HPP
+
+//! @file
+//! @brief The running consistency statistics decorator.
+//!
+//! @details Provides the filter decorator of the normalized innovation squared,
+//! the likelihood, and the innovation moments. Include with the header of the
+//! decorated filter.
+
+#include "kalman_internal/statistics.hpp"
+
+#include <cstddef>
+
+namespace fcarouge {
+//! @name Decorators
+//! @{
+
+//! @brief Filter decorator of the running consistency statistics.
+//!
+//! @details Pipe decorator to filter declaration to compute at each update the
+//! normalized innovation squared `nis()`, the logarithm of the likelihood
+//! `log_likelihood()`, and the `mean()` and `variance()` of the innovations
+//! over a sliding window of `Window` updates. Opt-in, the undecorated filters
+//! do not compute them.
+//!
+//! @tparam Window The number of innovations of the sliding window.
+template <std::size_t Window = 32>
+inline constexpr statistician<Window> statistics;
+
+//! @}
+} // namespace fcarouge
+
+#endif // FCAROUGE_KALMAN_STATISTICS_HPP
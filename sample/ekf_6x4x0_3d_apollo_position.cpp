@@ -41,6 +41,7 @@ For more information, please refer to <https://unlicense.org> */
 
 #include <cassert>
 #include <cmath>
+#include <type_traits>
 
 namespace fcarouge::sample {
 namespace {
@@ -100,70 +101,36 @@ using state = fcarouge::state<vector<6>>;
                          {0., 0.5 * 0.5, 0., 0.},
                          {0., 0., 0.005 * 0.005, 0.},
                          {0., 0., 0., 0.005 * 0.005}},
-      // The output model H is the Jacobian, linearization around the current
-      // state. Complex derivation omitted for brevity, using a simplified
-      // approximation.
-      output_model{[](const vector<6> &x) {
+      // The state transition function f assumes the constant relative velocity
+      // over the time step. The functions are generic over the scalar type such
+      // that the filter derives the state transition F = ∂f/∂X and the output
+      // model H = ∂h/∂X Jacobians by automatic differentiation.
+      transition{[](const auto &x, const double &dt) {
         const auto &[rx, ry, rz, vx, vy, vz]{x};
-        double range{std::sqrt(rx * rx + ry * ry + rz * rz)};
-        // For production, guard against divide by zero range, if the spacecraft
-        // are touching.
-        double range_rate{(rx * vx + ry * vy + rz * vz) / range};
-        matrix<4, 6> h{matrix<4, 6>::Zero()};
-
-        // For range and range rate: the quotient rule applications for ∂ṙ/∂x.
-        // d(Range) / d(State)
-        h[0, 0] = rx / range;
-        h[0, 1] = ry / range;
-        h[0, 2] = rz / range;
-
-        // d(RangeRate) / d(State): Complex derivation omitted for brevity,
-        // simplified approximation.
-        h[1, 0] = (vx * range - rx * range_rate) / (range * range); // dRR/dx
-        h[1, 1] = (vy * range - ry * range_rate) / (range * range); // dRR/dy
-        h[1, 2] = (vz * range - rz * range_rate) / (range * range); // dRR/dz
-        h[1, 3] = rx / range;                                       // dRR/dvx
-        h[1, 4] = ry / range;                                       // dRR/dvy
-        h[1, 5] = rz / range;                                       // dRR/dvz
-
-        // For the shaft/azimuth: the derivative of atan2.
-        // d(Shaft) / d(State)
-        double r2_xy{rx * rx + ry * ry};
-        // For production, guard against divide by zero.
-        h[2, 0] = -ry / r2_xy;
-        h[2, 1] = rx / r2_xy;
-
-        // For the trunnion/elevation: the derivative of asin(z/r):
-        // d(z/r)/dState * sqrt(1-(z/r)^2). d(Trunnion) / d(State)
-        double term{std::sqrt(1 - (rz * rz) / (range * range))};
-        h[3, 0] = (-rz * rx) / (range * range * range * term);
-        h[3, 1] = (-rz * ry) / (range * range * range * term);
-        h[3, 2] = (range * range - rz * rz) / (range * range * range * term);
+        using scalar = std::remove_cvref_t<decltype(rx)>;
 
-        return h;
-      }},
-      // The state transition matrix F:
-      state_transition{[](const double &dt) {
-        return matrix<6, 6>{{1., 0., 0., dt, 0., 0.}, //
-                            {0., 1., 0., 0., dt, 0.}, //
-                            {0., 0., 1., 0., 0., dt}, //
-                            {0., 0., 0., 1., 0., 0.}, //
-                            {0., 0., 0., 0., 1., 0.}, //
-                            {0., 0., 0., 0., 0., 1.}};
+        return column_vector<scalar, 6>{rx + vx * dt, ry + vy * dt,
+                                        rz + vz * dt, vx, vy, vz};
       }},
       // The observation estimation Z:
-      observation{[](const vector<6> &x) {
+      observation{[](const auto &x) {
+        using std::asin;
+        using std::atan2;
+        using std::sqrt;
         const auto &[rx, ry, rz, vx, vy, vz]{x};
-        double range{std::sqrt(rx * rx + ry * ry + rz * rz)};
+        const auto range{sqrt(rx * rx + ry * ry + rz * rz)};
         // For production, guard against divide by zero.
-        double range_rate{(rx * vx + ry * vy + rz * vz) / range};
+        const auto range_rate{(rx * vx + ry * vy + rz * vz) / range};
         // The shaft angle in the xy plane usually, or defined by radar gimbal
         // is simplified here for illustration.
-        double shaft{std::atan2(ry, rx)};
-        double trunnion{std::asin(rz / range)};
+        const auto shaft{atan2(ry, rx)};
+        const auto trunnion{asin(rz / range)};
+        using scalar = std::remove_cvref_t<decltype(range)>;
 
-        return vector<4>{range, range_rate, shaft, trunnion};
+        return column_vector<scalar, 4>{range, range_rate, shaft, trunnion};
       }},
+      // No additional parameter for update.
+      update_types<>,
       // One additional parameter for prediction: time update (dt).
       prediction_types<double>
       // For production, the innovation angles, residuals should be normalized,
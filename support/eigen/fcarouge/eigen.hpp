@@ -46,11 +46,17 @@ For more information, please refer to <https://unlicense.org> */
 //!
 //! @note The Eigen3 linear algebra is not constexpr-compatible as of July 2023.
 
+#include "fcarouge/kalman_internal/dual.hpp"
+#include "fcarouge/kalman_internal/sampling.hpp"
 #include "fcarouge/kalman_internal/utility.hpp"
 
+#include <cassert>
+#include <cmath>
 #include <concepts>
 #include <cstddef>
 #include <format>
+#include <limits>
+#include <random>
 #include <sstream>
 #include <tuple>
 #include <type_traits>
@@ -106,9 +112,183 @@ template <eigen::is_eigen Type> struct evaluates<Type> {
   [[nodiscard]] static constexpr auto operator()() ->
       typename Type::PlainMatrix;
 };
+
+//! @brief Specialization of the juxtaposition type.
+//!
+//! @details The column vectors are juxtaposed in the columns of a contiguous
+//! column-major matrix.
+template <eigen::is_eigen Type, std::size_t Count>
+  requires(Type::ColsAtCompileTime == 1)
+struct juxtaposes<Type, Count> {
+  using type = eigen::matrix<typename Type::Scalar, Type::RowsAtCompileTime,
+                             static_cast<int>(Count)>;
+};
+
+//! @brief Specialization of the scalar rebinding.
+template <eigen::is_eigen Type, typename Scalar> struct rebinds<Type, Scalar> {
+  using type = eigen::matrix<Scalar, Type::RowsAtCompileTime,
+                             Type::ColsAtCompileTime>;
+};
+
+//! @brief Specialization of the column access.
+template <typename Type>
+  requires eigen::is_eigen<std::remove_const_t<Type>>
+struct columns<Type> {
+  [[nodiscard]] static constexpr auto operator()(Type &value,
+                                                 std::size_t index) {
+    return value.col(static_cast<Eigen::Index>(index));
+  }
+};
+
+//! @brief Specialization of the element access.
+template <typename Type>
+  requires eigen::is_eigen<std::remove_const_t<Type>>
+struct elements<Type> {
+  [[nodiscard]] static constexpr decltype(auto) operator()(Type &value,
+                                                           std::size_t index) {
+    return value(static_cast<Eigen::Index>(index));
+  }
+};
+
+//! @brief Specialization of the factorization.
+//!
+//! @details This demonstrator uses the standard Cholesky decomposition. A
+//! semidefinite matrix, for example a null process noise, falls back on the
+//! Cholesky factor with a null column per null pivot, still lower triangular.
+//! An indefinite matrix has no factor.
+template <eigen::is_eigen Type> struct factorizes<Type> {
+  [[nodiscard]] static constexpr auto operator()(const Type &value) ->
+      typename Type::PlainMatrix {
+    using matrix = typename Type::PlainMatrix;
+    using scalar = typename Type::Scalar;
+
+    const Eigen::LLT<matrix> decomposition{value};
+    if (decomposition.info() == Eigen::Success) {
+      return decomposition.matrixL();
+    }
+
+    const matrix a{value};
+    const scalar tolerance{static_cast<scalar>(a.rows()) *
+                           std::numeric_limits<scalar>::epsilon() *
+                           a.diagonal().cwiseAbs().maxCoeff()};
+    matrix result{matrix::Zero(a.rows(), a.cols())};
+    for (Eigen::Index j{0}; j < a.cols(); ++j) {
+      const scalar pivot{a(j, j) - result.row(j).head(j).squaredNorm()};
+      assert(pivot >= -tolerance && "The matrix is not positive semidefinite.");
+      if (pivot <= tolerance) {
+        continue;
+      }
+      result(j, j) = std::sqrt(pivot);
+      for (Eigen::Index i{j + 1}; i < a.rows(); ++i) {
+        result(i, j) =
+            (a(i, j) - result.row(i).head(j).dot(result.row(j).head(j))) /
+            result(j, j);
+      }
+    }
+
+    return result;
+  }
+};
+
+//! @brief Specialization of the determinant.
+template <eigen::is_eigen Type> struct determinants<Type> {
+  [[nodiscard]] static constexpr auto operator()(const Type &value) ->
+      typename Type::Scalar {
+    return value.determinant();
+  }
+};
+
+//! @brief Specialization of the standard normal sampling.
+template <eigen::is_eigen Type> struct normals<Type> {
+  template <typename Engine>
+  [[nodiscard]] static auto operator()(Engine &engine) ->
+      typename Type::PlainMatrix {
+    std::normal_distribution<typename Type::Scalar> distribution;
+    typename Type::PlainMatrix result;
+
+    for (Eigen::Index index{0}; index < result.size(); ++index) {
+      result(index) = distribution(engine);
+    }
+
+    return result;
+  }
+};
+
+//! @brief Specialization of the factor downdate.
+//!
+//! @details Successive rank-one downdates of the lower triangular factor, one
+//! per column of the `U` matrix. Falls back on the factorization of the
+//! downdated product when the downdate loses positive definiteness.
+template <eigen::is_eigen L, eigen::is_eigen U> struct downdates<L, U> {
+  [[nodiscard]] static constexpr auto operator()(const L &l, const U &u) ->
+      typename L::PlainMatrix {
+    typename L::PlainMatrix result{l};
+
+    for (Eigen::Index j{0}; j < u.cols(); ++j) {
+      eigen::column_vector<typename U::Scalar, U::RowsAtCompileTime> w{
+          u.col(j)};
+
+      for (Eigen::Index i{0}; i < result.rows(); ++i) {
+        const auto diagonal{result(i, i)};
+        const auto squared{diagonal * diagonal - w(i) * w(i)};
+
+        if (!(squared > 0)) {
+          return factorizes<typename L::PlainMatrix>{}(l * l.transpose() -
+                                                       u * u.transpose());
+        }
+
+        const auto radius{std::sqrt(squared)};
+        const auto cosine{radius / diagonal};
+        const auto sine{w(i) / diagonal};
+
+        result(i, i) = radius;
+        for (Eigen::Index k{i + 1}; k < result.rows(); ++k) {
+          result(k, i) = (result(k, i) - sine * w(k)) / cosine;
+          w(k) = cosine * w(k) - sine * result(k, i);
+        }
+      }
+    }
+
+    return result;
+  }
+};
 } // namespace fcarouge::kalman_internal
 
 namespace Eigen {
+//! @brief Eigen numerical traits of the automatic differentiation dual number.
+//!
+//! @details The dual number is a real, signed, non-integer scalar of the cost
+//! of its partial derivatives.
+template <typename Type, std::size_t Size>
+struct NumTraits<fcarouge::kalman_internal::dual<Type, Size>>
+    : NumTraits<Type> {
+  using Real = fcarouge::kalman_internal::dual<Type, Size>;
+  using NonInteger = Real;
+  using Nested = Real;
+  using Literal = Type;
+
+  enum {
+    RequireInitialization = 1,
+    ReadCost = (Size + 1) * NumTraits<Type>::ReadCost,
+    AddCost = (Size + 1) * NumTraits<Type>::AddCost,
+    MulCost = (2 * Size + 1) * NumTraits<Type>::MulCost
+  };
+};
+
+//! @brief Eigen mixed scalar operations of the dual number and its scalar.
+template <typename Type, std::size_t Size, typename BinaryOperation>
+struct ScalarBinaryOpTraits<fcarouge::kalman_internal::dual<Type, Size>, Type,
+                            BinaryOperation> {
+  using ReturnType = fcarouge::kalman_internal::dual<Type, Size>;
+};
+
+//! @brief Eigen mixed scalar operations of the scalar and its dual number.
+template <typename Type, std::size_t Size, typename BinaryOperation>
+struct ScalarBinaryOpTraits<Type, fcarouge::kalman_internal::dual<Type, Size>,
+                            BinaryOperation> {
+  using ReturnType = fcarouge::kalman_internal::dual<Type, Size>;
+};
+
 //! @brief Eigen matrix solution to division.
 //!
 //! @details Argument-dependent lookup (ADL) used for type definition orgering
@@ -243,4 +423,8 @@ struct std::tuple_element<Index, Type> {
   using type = typename Type::Scalar;
 };
 
+#if defined(FCAROUGE_KALMAN_DISPATCH_KERNELS)
+#include "kernel.hpp"
+#endif
+
 #endif // FCAROUGE_EIGEN_HPP
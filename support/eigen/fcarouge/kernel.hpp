@@ -0,0 +1,240 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_KERNEL_HPP
+#define FCAROUGE_KERNEL_HPP
+
+//! @file
+//! @brief Runtime dispatched covariance and gain kernels for Eigen3 matrices.
+//!
+//! @details Eigen3 selects its vector instructions at compile time from the
+//! target architecture flags. A portable build of the library therefore only
+//! uses the baseline instruction set. The covariance propagation, Joseph form
+//! correction, and gain kernels are compiled for the AVX-512, AVX2, and
+//! baseline instruction sets, the best one being selected at load time from the
+//! running processor. The gain kernel dispatches the `P * Hᵀ` product, the
+//! small innovation uncertainty solve remaining with Eigen3. Available with GCC
+//! for x86-64 Linux targets. The statically sized column-major floating-point
+//! matrices of at least eight rows are dispatched, smaller matrices being
+//! faster with the unrolled Eigen3 products.
+//!
+//! The kernels are enabled by the `FCAROUGE_KALMAN_DISPATCH_KERNELS` compile
+//! definition of the Eigen3 backend target. The Eigen3 backend header includes
+//! this header when the definition is set, such that every translation unit of
+//! a target sees the same specializations. Set the definition for the whole
+//! program, never per translation unit.
+
+#include "eigen.hpp"
+#include "fcarouge/kalman_internal/utility.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+
+#include <Eigen/Eigen>
+
+#if defined(FCAROUGE_KALMAN_DISPATCH_KERNELS) && defined(__GNUC__) &&         \
+    !defined(__clang__) && defined(__x86_64__) && defined(__linux__)
+
+namespace fcarouge::eigen {
+//! @name Concepts
+//! @{
+
+//! @brief The minimum number of rows of the dispatched covariance kernels.
+inline constexpr int dispatch_rows{8};
+
+//! @brief Eigen3 types eligible to the dispatched kernels.
+//!
+//! @details Column-major floating-point matrices or expressions of the given
+//! scalar type and static size.
+template <typename Type, typename Scalar, auto Row, auto Column>
+concept dispatchable =
+    requires { typename Type::PlainMatrix; } &&
+    std::same_as<typename Type::Scalar, Scalar> &&
+    std::floating_point<Scalar> && Type::PlainMatrix::IsRowMajor == 0 &&
+    Type::RowsAtCompileTime == Row && Type::ColsAtCompileTime == Column &&
+    Row >= 1 && Column >= 1;
+
+//! @}
+
+//! @name Functions
+//! @{
+
+//! @brief Accumulates the `A * B * Aᵀ` product in the result.
+//!
+//! @details The column-major `A` matrix has `Row` rows and `Column` columns,
+//! and the `B` matrix is square. The inner loops run over contiguous columns
+//! for the compiler to vectorize each clone with its instruction set.
+template <typename Scalar, std::size_t Row, std::size_t Column>
+[[gnu::target_clones("avx512f", "avx2", "default")]] void
+sandwich(const Scalar *__restrict__ a, const Scalar *__restrict__ b,
+         Scalar *__restrict__ result) {
+  std::array<Scalar, Row * Column> ab{};
+
+  for (std::size_t j{0}; j < Column; ++j) {
+    for (std::size_t k{0}; k < Column; ++k) {
+      const Scalar b_kj{b[j * Column + k]};
+      for (std::size_t i{0}; i < Row; ++i) {
+        ab[j * Row + i] += a[k * Row + i] * b_kj;
+      }
+    }
+  }
+
+  for (std::size_t j{0}; j < Row; ++j) {
+    for (std::size_t k{0}; k < Column; ++k) {
+      const Scalar a_jk{a[k * Row + j]};
+      for (std::size_t i{0}; i < Row; ++i) {
+        result[j * Row + i] += ab[k * Row + i] * a_jk;
+      }
+    }
+  }
+}
+
+//! @brief Accumulates the `A * Bᵀ` product in the result.
+//!
+//! @details The column-major `A` matrix has `Row` rows and `Inner` columns,
+//! and the `B` matrix has `Column` rows and `Inner` columns. The inner loop
+//! runs over contiguous columns for the compiler to vectorize each clone with
+//! its instruction set.
+template <typename Scalar, std::size_t Row, std::size_t Inner,
+          std::size_t Column>
+[[gnu::target_clones("avx512f", "avx2", "default")]] void
+project(const Scalar *__restrict__ a, const Scalar *__restrict__ b,
+        Scalar *__restrict__ result) {
+  for (std::size_t j{0}; j < Column; ++j) {
+    for (std::size_t k{0}; k < Inner; ++k) {
+      const Scalar b_jk{b[k * Column + j]};
+      for (std::size_t i{0}; i < Row; ++i) {
+        result[j * Row + i] += a[k * Row + i] * b_jk;
+      }
+    }
+  }
+}
+
+//! @}
+} // namespace fcarouge::eigen
+
+namespace fcarouge::kalman_internal {
+//! @brief Specialization of the covariance propagation with the dispatched
+//! kernel.
+template <typename A, typename P, eigen::is_eigen Q>
+  requires(Q::RowsAtCompileTime >= eigen::dispatch_rows) &&
+          eigen::dispatchable<Q, typename Q::Scalar, Q::RowsAtCompileTime,
+                              Q::RowsAtCompileTime> &&
+          eigen::dispatchable<A, typename Q::Scalar, Q::RowsAtCompileTime,
+                              Q::RowsAtCompileTime> &&
+          eigen::dispatchable<P, typename Q::Scalar, Q::RowsAtCompileTime,
+                              Q::RowsAtCompileTime>
+struct propagates<A, P, Q> {
+  [[nodiscard]] static auto operator()(const A &a, const P &p, const Q &q) ->
+      typename Q::PlainMatrix {
+    using scalar = typename Q::Scalar;
+    constexpr std::size_t size{Q::RowsAtCompileTime};
+    const typename A::PlainMatrix a_value{a};
+    const typename P::PlainMatrix p_value{p};
+    typename Q::PlainMatrix result{q};
+
+    eigen::sandwich<scalar, size, size>(a_value.data(), p_value.data(),
+                                        result.data());
+
+    return result;
+  }
+};
+
+//! @brief Specialization of the Joseph form covariance correction with the
+//! dispatched kernel.
+template <typename A, eigen::is_eigen P, typename K, eigen::is_eigen R>
+  requires(P::RowsAtCompileTime >= eigen::dispatch_rows) &&
+          eigen::dispatchable<P, typename P::Scalar, P::RowsAtCompileTime,
+                              P::RowsAtCompileTime> &&
+          eigen::dispatchable<A, typename P::Scalar, P::RowsAtCompileTime,
+                              P::RowsAtCompileTime> &&
+          eigen::dispatchable<R, typename P::Scalar, R::RowsAtCompileTime,
+                              R::RowsAtCompileTime> &&
+          eigen::dispatchable<K, typename P::Scalar, P::RowsAtCompileTime,
+                              R::RowsAtCompileTime>
+struct corrects<A, P, K, R> {
+  [[nodiscard]] static auto operator()(const A &a, const P &p, const K &k,
+                                       const R &r) ->
+      typename P::PlainMatrix {
+    using scalar = typename P::Scalar;
+    constexpr std::size_t size{P::RowsAtCompileTime};
+    constexpr std::size_t output_size{R::RowsAtCompileTime};
+    const typename A::PlainMatrix a_value{a};
+    const typename P::PlainMatrix p_value{p};
+    const typename K::PlainMatrix k_value{k};
+    const typename R::PlainMatrix r_value{r};
+    typename P::PlainMatrix result{P::PlainMatrix::Zero()};
+
+    eigen::sandwich<scalar, size, size>(a_value.data(), p_value.data(),
+                                        result.data());
+    eigen::sandwich<scalar, size, output_size>(
+        k_value.data(), r_value.data(), result.data());
+
+    return result;
+  }
+};
+
+//! @brief Specialization of the gain weighing with the dispatched kernel.
+template <eigen::is_eigen P, eigen::is_eigen H, typename S>
+  requires(P::RowsAtCompileTime >= eigen::dispatch_rows) &&
+          eigen::dispatchable<P, typename P::Scalar, P::RowsAtCompileTime,
+                              P::RowsAtCompileTime> &&
+          eigen::dispatchable<H, typename P::Scalar, H::RowsAtCompileTime,
+                              P::RowsAtCompileTime>
+struct weighs<P, H, S> {
+  [[nodiscard]] static auto operator()(const P &p, const H &h, const S &s) {
+    using scalar = typename P::Scalar;
+    constexpr std::size_t size{P::RowsAtCompileTime};
+    constexpr std::size_t output_size{H::RowsAtCompileTime};
+    const typename P::PlainMatrix p_value{p};
+    const typename H::PlainMatrix h_value{h};
+    eigen::matrix<scalar, size, output_size> product{
+        eigen::matrix<scalar, size, output_size>::Zero()};
+
+    eigen::project<scalar, size, size, output_size>(
+        p_value.data(), h_value.data(), product.data());
+
+    return product / s;
+  }
+};
+} // namespace fcarouge::kalman_internal
+
+#endif
+
+#endif // FCAROUGE_KERNEL_HPP
@@ -0,0 +1,574 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_LIE_HPP
+#define FCAROUGE_LIE_HPP
+
+//! @file
+//! @brief Lie groups of rotations and rigid motions with Eigen3 implementation.
+//!
+//! @details The unit quaternion and SO(3) rotations, and the SE(3) rigid
+//! motions, usable as the nominal state of the error-state filter. The tangent
+//! perturbations are local, on the right: `x ⊞ τ = x * exp(τ)` and
+//! `y ⊟ x = log(x⁻¹ * y)`. The right and left Jacobians of the exponential map,
+//! and their inverses for the logarithm map, are in closed form. The SE(3)
+//! tangent vector is the translation part ρ followed by the rotation part θ.
+//! Small angles are evaluated by their Taylor series.
+
+#include "eigen.hpp"
+#include "fcarouge/kalman_internal/utility.hpp"
+
+#include <cmath>
+#include <concepts>
+#include <limits>
+
+#include <Eigen/Eigen>
+
+namespace fcarouge::eigen {
+//! @name Concepts
+//! @{
+
+//! @brief A Lie group concept.
+//!
+//! @details Group of the composition, inverse, exponential, and logarithm maps.
+template <typename Type>
+concept lie_group = requires(Type value, typename Type::tangent tau) {
+  { Type::exp(tau) } -> std::same_as<Type>;
+  { value.log() } -> std::same_as<typename Type::tangent>;
+  { value.inverse() } -> std::same_as<Type>;
+  { value * value } -> std::same_as<Type>;
+};
+
+//! @}
+
+//! @name Functions
+//! @{
+
+//! @brief The skew-symmetric cross product matrix `[v]ₓ` of a vector.
+template <typename Type>
+[[nodiscard]] auto hat(const column_vector<Type, 3> &v) -> matrix<Type, 3, 3> {
+  return matrix<Type, 3, 3>{
+      {0, -v(2), v(1)}, {v(2), 0, -v(0)}, {-v(1), v(0), 0}};
+}
+
+//! @}
+
+//! @name Types
+//! @{
+
+//! @brief The SO(3) group of the rotations of the space.
+//!
+//! @details Represented by the orthogonal rotation matrix R.
+//!
+//! @tparam Type The scalar type.
+template <typename Type = double> class so3 {
+public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief Type of the tangent rotation vector θ.
+  using tangent = column_vector<Type, 3>;
+
+  //! @brief Type of the Jacobians and adjoint.
+  using jacobian = matrix<Type, 3, 3>;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs the identity rotation.
+  so3() = default;
+
+  //! @brief Constructs the rotation of the orthogonal matrix.
+  explicit so3(const jacobian &rotation) : r{rotation} {}
+
+  //! @brief Returns the rotation of the rotation vector.
+  //!
+  //! @details The Rodrigues formula `I + sin θ / θ * [θ]ₓ + (1 - cos θ) / θ² *
+  //! [θ]ₓ²`.
+  [[nodiscard]] static auto exp(const tangent &theta) -> so3 {
+    const coefficients c{theta};
+    const jacobian skew{hat(theta)};
+    return so3{jacobian{jacobian::Identity() + c.sine * skew +
+                        c.cosine * skew * skew}};
+  }
+
+  //! @brief Returns the rotation vector of the rotation.
+  [[nodiscard]] auto log() const -> tangent {
+    const Eigen::AngleAxis<Type> rotation{r};
+    return tangent{rotation.angle() * rotation.axis()};
+  }
+
+  //! @brief Returns the inverse, transposed, rotation.
+  [[nodiscard]] auto inverse() const -> so3 { return so3{r.transpose()}; }
+
+  //! @brief Returns the composition of the rotations.
+  [[nodiscard]] auto operator*(const so3 &other) const -> so3 {
+    return so3{jacobian{r * other.r}};
+  }
+
+  //! @brief Returns the rotated point.
+  [[nodiscard]] auto operator*(const tangent &point) const -> tangent {
+    return r * point;
+  }
+
+  //! @brief Returns the rotation perturbed by the tangent vector on the right.
+  [[nodiscard]] auto plus(const tangent &theta) const -> so3 {
+    return *this * exp(theta);
+  }
+
+  //! @brief Returns the tangent vector from the other rotation to this one.
+  [[nodiscard]] auto minus(const so3 &other) const -> tangent {
+    return (other.inverse() * *this).log();
+  }
+
+  //! @brief Returns the adjoint, the rotation matrix.
+  [[nodiscard]] auto adjoint() const -> jacobian { return r; }
+
+  //! @brief Returns the rotation matrix.
+  [[nodiscard]] auto data() const -> const jacobian & { return r; }
+
+  //! @brief Returns the right Jacobian of the exponential map.
+  //!
+  //! @details The closed form
+  //! `Jr(θ) = I - (1 - cos θ) / θ² * [θ]ₓ + (θ - sin θ) / θ³ * [θ]ₓ²`.
+  [[nodiscard]] static auto right_jacobian(const tangent &theta) -> jacobian {
+    const coefficients c{theta};
+    const jacobian skew{hat(theta)};
+    return jacobian::Identity() - c.cosine * skew + c.cubic * skew * skew;
+  }
+
+  //! @brief Returns the inverse of the right Jacobian of the exponential map,
+  //! the right Jacobian of the logarithm map.
+  //!
+  //! @details The closed form `Jr⁻¹(θ) = I + [θ]ₓ / 2 +
+  //! (1 - θ / 2 * cot(θ / 2)) / θ² * [θ]ₓ²`, defined up to the half turn.
+  [[nodiscard]] static auto right_jacobian_inverse(const tangent &theta)
+      -> jacobian {
+    const coefficients c{theta};
+    const jacobian skew{hat(theta)};
+    return jacobian::Identity() + skew / 2 + c.inverse * skew * skew;
+  }
+
+  //! @brief Returns the left Jacobian of the exponential map `Jl(θ) = Jr(-θ)`.
+  [[nodiscard]] static auto left_jacobian(const tangent &theta) -> jacobian {
+    return right_jacobian(tangent{-theta});
+  }
+
+  //! @brief Returns the inverse of the left Jacobian of the exponential map.
+  [[nodiscard]] static auto left_jacobian_inverse(const tangent &theta)
+      -> jacobian {
+    return right_jacobian_inverse(tangent{-theta});
+  }
+
+  [[nodiscard]] friend auto operator==(const so3 &lhs, const so3 &rhs)
+      -> bool {
+    return lhs.r == rhs.r;
+  }
+
+  //! @}
+
+private:
+  template <typename> friend class se3;
+
+  // The coefficients of the closed-form maps, evaluated by their Taylor series
+  // below the angle where the closed forms lose precision.
+  struct coefficients {
+    explicit coefficients(const tangent &theta) {
+      using std::cos;
+      using std::sin;
+      using std::sqrt;
+      const Type squared{theta.squaredNorm()};
+      const Type fourth{squared * squared};
+      if (squared < sqrt(sqrt(std::numeric_limits<Type>::epsilon()))) {
+        sine = 1 - squared / 6 + fourth / 120;
+        cosine = Type{1} / 2 - squared / 24 + fourth / 720;
+        cubic = Type{1} / 6 - squared / 120 + fourth / 5040;
+        inverse = Type{1} / 12 + squared / 720 + fourth / 30240;
+        quartic = Type{1} / 24 - squared / 720 + fourth / 40320;
+        quintic = Type{1} / 120 - squared / 2520 + fourth / 120960;
+      } else {
+        const Type angle{sqrt(squared)};
+        const Type s{sin(angle)};
+        const Type c{cos(angle)};
+        sine = s / angle;
+        cosine = (1 - c) / squared;
+        cubic = (angle - s) / (squared * angle);
+        inverse = (1 - angle * cos(angle / 2) / (2 * sin(angle / 2))) / squared;
+        quartic = (squared + 2 * c - 2) / (2 * fourth);
+        quintic = (2 * angle - 3 * s + angle * c) / (2 * fourth * angle);
+      }
+    }
+
+    // sin θ / θ
+    Type sine;
+    // (1 - cos θ) / θ²
+    Type cosine;
+    // (θ - sin θ) / θ³
+    Type cubic;
+    // (1 - θ / 2 * cot(θ / 2)) / θ²
+    Type inverse;
+    // (θ² + 2 * cos θ - 2) / (2 * θ⁴)
+    Type quartic;
+    // (2 * θ - 3 * sin θ + θ * cos θ) / (2 * θ⁵)
+    Type quintic;
+  };
+
+  jacobian r{jacobian::Identity()};
+};
+
+//! @brief The unit quaternion group of the rotations of the space.
+//!
+//! @details Represented by the unit quaternion q, double cover of SO(3). The
+//! Jacobians are those of the SO(3) group.
+//!
+//! @tparam Type The scalar type.
+template <typename Type = double> class quaternion {
+public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief Type of the tangent rotation vector θ.
+  using tangent = column_vector<Type, 3>;
+
+  //! @brief Type of the Jacobians and adjoint.
+  using jacobian = matrix<Type, 3, 3>;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs the identity rotation.
+  quaternion() = default;
+
+  //! @brief Constructs the rotation of the normalized quaternion.
+  explicit quaternion(const Eigen::Quaternion<Type> &value)
+      : q{value.normalized()} {}
+
+  //! @brief Constructs the rotation of the normalized quaternion coefficients.
+  quaternion(Type w, Type x, Type y, Type z)
+      : quaternion{Eigen::Quaternion<Type>{w, x, y, z}} {}
+
+  //! @brief Returns the rotation of the rotation vector.
+  //!
+  //! @details `q = (cos(θ / 2), sin(θ / 2) / θ * θ)`.
+  [[nodiscard]] static auto exp(const tangent &theta) -> quaternion {
+    using std::cos;
+    using std::sin;
+    using std::sqrt;
+    const Type squared{theta.squaredNorm()};
+    const Type angle{sqrt(squared)};
+    const Type half{
+        squared < sqrt(sqrt(std::numeric_limits<Type>::epsilon()))
+            ? Type{1} / 2 - squared / 48 + squared * squared / 3840
+            : sin(angle / 2) / angle};
+    quaternion rotation;
+    rotation.q.w() = cos(angle / 2);
+    rotation.q.vec() = half * theta;
+    return rotation;
+  }
+
+  //! @brief Returns the rotation vector of the rotation.
+  [[nodiscard]] auto log() const -> tangent {
+    const Eigen::AngleAxis<Type> rotation{q};
+    return tangent{rotation.angle() * rotation.axis()};
+  }
+
+  //! @brief Returns the inverse, conjugated, rotation.
+  [[nodiscard]] auto inverse() const -> quaternion {
+    return quaternion{q.conjugate()};
+  }
+
+  //! @brief Returns the composition of the rotations.
+  [[nodiscard]] auto operator*(const quaternion &other) const -> quaternion {
+    return quaternion{q * other.q};
+  }
+
+  //! @brief Returns the rotated point.
+  [[nodiscard]] auto operator*(const tangent &point) const -> tangent {
+    return q * point;
+  }
+
+  //! @brief Returns the rotation perturbed by the tangent vector on the right.
+  [[nodiscard]] auto plus(const tangent &theta) const -> quaternion {
+    return *this * exp(theta);
+  }
+
+  //! @brief Returns the tangent vector from the other rotation to this one.
+  [[nodiscard]] auto minus(const quaternion &other) const -> tangent {
+    return (other.inverse() * *this).log();
+  }
+
+  //! @brief Returns the adjoint, the rotation matrix.
+  [[nodiscard]] auto adjoint() const -> jacobian {
+    return q.toRotationMatrix();
+  }
+
+  //! @brief Returns the unit quaternion.
+  [[nodiscard]] auto data() const -> const Eigen::Quaternion<Type> & {
+    return q;
+  }
+
+  //! @brief Returns the right Jacobian of the exponential map.
+  [[nodiscard]] static auto right_jacobian(const tangent &theta) -> jacobian {
+    return so3<Type>::right_jacobian(theta);
+  }
+
+  //! @brief Returns the inverse of the right Jacobian of the exponential map.
+  [[nodiscard]] static auto right_jacobian_inverse(const tangent &theta)
+      -> jacobian {
+    return so3<Type>::right_jacobian_inverse(theta);
+  }
+
+  //! @brief Returns the left Jacobian of the exponential map.
+  [[nodiscard]] static auto left_jacobian(const tangent &theta) -> jacobian {
+    return so3<Type>::left_jacobian(theta);
+  }
+
+  //! @brief Returns the inverse of the left Jacobian of the exponential map.
+  [[nodiscard]] static auto left_jacobian_inverse(const tangent &theta)
+      -> jacobian {
+    return so3<Type>::left_jacobian_inverse(theta);
+  }
+
+  [[nodiscard]] friend auto operator==(const quaternion &lhs,
+                                       const quaternion &rhs) -> bool {
+    return lhs.q.coeffs() == rhs.q.coeffs();
+  }
+
+  //! @}
+
+private:
+  Eigen::Quaternion<Type> q{Eigen::Quaternion<Type>::Identity()};
+};
+
+//! @brief The SE(3) group of the rigid motions of the space.
+//!
+//! @details Represented by the rotation R and the translation t.
+//!
+//! @tparam Type The scalar type.
+template <typename Type = double> class se3 {
+public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief Type of the tangent vector τ = (ρ, θ).
+  using tangent = column_vector<Type, 6>;
+
+  //! @brief Type of the Jacobians and adjoint.
+  using jacobian = matrix<Type, 6, 6>;
+
+  //! @brief Type of the translation and of the points.
+  using translation = column_vector<Type, 3>;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs the identity motion.
+  se3() = default;
+
+  //! @brief Constructs the motion of the rotation and translation.
+  se3(const so3<Type> &rotation, const translation &position)
+      : r{rotation}, t{position} {}
+
+  //! @brief Returns the motion of the tangent vector.
+  //!
+  //! @details `R = exp(θ)` and `t = Jl(θ) * ρ`.
+  [[nodiscard]] static auto exp(const tangent &tau) -> se3 {
+    const axis_angle theta{tau.template tail<3>()};
+    return se3{so3<Type>::exp(theta),
+               so3<Type>::left_jacobian(theta) * tau.template head<3>()};
+  }
+
+  //! @brief Returns the tangent vector of the motion.
+  [[nodiscard]] auto log() const -> tangent {
+    const axis_angle theta{r.log()};
+    tangent tau;
+    tau << so3<Type>::left_jacobian_inverse(theta) * t, theta;
+    return tau;
+  }
+
+  //! @brief Returns the inverse motion.
+  [[nodiscard]] auto inverse() const -> se3 {
+    const so3<Type> transposed{r.inverse()};
+    return se3{transposed, translation{-(transposed * t)}};
+  }
+
+  //! @brief Returns the composition of the motions.
+  [[nodiscard]] auto operator*(const se3 &other) const -> se3 {
+    return se3{r * other.r, translation{t + r * other.t}};
+  }
+
+  //! @brief Returns the transformed point.
+  [[nodiscard]] auto operator*(const translation &point) const
+      -> translation {
+    return translation{r * point + t};
+  }
+
+  //! @brief Returns the motion perturbed by the tangent vector on the right.
+  [[nodiscard]] auto plus(const tangent &tau) const -> se3 {
+    return *this * exp(tau);
+  }
+
+  //! @brief Returns the tangent vector from the other motion to this one.
+  [[nodiscard]] auto minus(const se3 &other) const -> tangent {
+    return (other.inverse() * *this).log();
+  }
+
+  //! @brief Returns the adjoint `[[R, [t]ₓ * R], [0, R]]`.
+  [[nodiscard]] auto adjoint() const -> jacobian {
+    jacobian value{jacobian::Zero()};
+    value.template topLeftCorner<3, 3>() = r.data();
+    value.template topRightCorner<3, 3>() = hat(t) * r.data();
+    value.template bottomRightCorner<3, 3>() = r.data();
+    return value;
+  }
+
+  //! @brief Returns the rotation.
+  [[nodiscard]] auto rotation_part() const -> const so3<Type> & { return r; }
+
+  //! @brief Returns the translation.
+  [[nodiscard]] auto translation_part() const -> const translation & {
+    return t;
+  }
+
+  //! @brief Returns the left Jacobian of the exponential map.
+  //!
+  //! @details `Jl(τ) = [[Jl(θ), Q(ρ, θ)], [0, Jl(θ)]]`.
+  [[nodiscard]] static auto left_jacobian(const tangent &tau) -> jacobian {
+    const axis_angle theta{tau.template tail<3>()};
+    const block left{so3<Type>::left_jacobian(theta)};
+    jacobian value{jacobian::Zero()};
+    value.template topLeftCorner<3, 3>() = left;
+    value.template topRightCorner<3, 3>() = q(tau);
+    value.template bottomRightCorner<3, 3>() = left;
+    return value;
+  }
+
+  //! @brief Returns the inverse of the left Jacobian of the exponential map.
+  //!
+  //! @details `Jl⁻¹(τ) = [[Jl⁻¹(θ), -Jl⁻¹(θ) * Q(ρ, θ) * Jl⁻¹(θ)], [0,
+  //! Jl⁻¹(θ)]]`.
+  [[nodiscard]] static auto left_jacobian_inverse(const tangent &tau)
+      -> jacobian {
+    const axis_angle theta{tau.template tail<3>()};
+    const block inverse{so3<Type>::left_jacobian_inverse(theta)};
+    jacobian value{jacobian::Zero()};
+    value.template topLeftCorner<3, 3>() = inverse;
+    value.template topRightCorner<3, 3>() = -inverse * q(tau) * inverse;
+    value.template bottomRightCorner<3, 3>() = inverse;
+    return value;
+  }
+
+  //! @brief Returns the right Jacobian of the exponential map `Jr(τ) = Jl(-τ)`.
+  [[nodiscard]] static auto right_jacobian(const tangent &tau) -> jacobian {
+    return left_jacobian(tangent{-tau});
+  }
+
+  //! @brief Returns the inverse of the right Jacobian of the exponential map.
+  [[nodiscard]] static auto right_jacobian_inverse(const tangent &tau)
+      -> jacobian {
+    return left_jacobian_inverse(tangent{-tau});
+  }
+
+  [[nodiscard]] friend auto operator==(const se3 &lhs, const se3 &rhs)
+      -> bool {
+    return lhs.r == rhs.r && lhs.t == rhs.t;
+  }
+
+  //! @}
+
+private:
+  using axis_angle = column_vector<Type, 3>;
+  using block = matrix<Type, 3, 3>;
+
+  // The coupling block of the left Jacobian of the exponential map.
+  [[nodiscard]] static auto q(const tangent &tau) -> block {
+    const axis_angle theta{tau.template tail<3>()};
+    const typename so3<Type>::coefficients c{theta};
+    const block p{hat(translation{tau.template head<3>()})};
+    const block o{hat(theta)};
+    const block op{o * p};
+    const block po{p * o};
+    const block opo{op * o};
+    return block{p / 2 + c.cubic * (op + po + opo) +
+                 c.quartic * (o * op + po * o - 3 * opo) +
+                 c.quintic * (opo * o + o * opo)};
+  }
+
+  so3<Type> r;
+  translation t{translation::Zero()};
+};
+
+//! @}
+
+} // namespace fcarouge::eigen
+
+namespace fcarouge::kalman_internal {
+//! @brief Specialization of the evaluation type of the Lie groups.
+template <eigen::lie_group Type> struct evaluates<Type> {
+  [[nodiscard]] static constexpr auto operator()() -> Type;
+};
+
+//! @brief Specialization of the transposes of the Lie groups, their inverse.
+template <eigen::lie_group Type> struct transposes<Type> {
+  [[nodiscard]] static constexpr auto operator()(const Type &value) {
+    return value.inverse();
+  }
+};
+
+//! @name Algebraic Named Values
+//! @{
+
+//! @brief The one Lie group element specialization, the identity.
+template <eigen::lie_group Type> inline Type one<Type>{};
+
+//! @brief The zero Lie group element specialization, the identity.
+//!
+//! @details The exponential of the zero tangent vector.
+template <eigen::lie_group Type> inline Type zero<Type>{};
+
+//! @}
+
+} // namespace fcarouge::kalman_internal
+
+#endif // FCAROUGE_LIE_HPP
@@ -72,7 +72,7 @@ function(sample SAMPLE_NAME)
       target_link_libraries(
         kalman_sample_${BACKEND}_${SAMPLE_NAME}_driver
         PRIVATE kalman kalman_main kalman_linalg_${BACKEND}
-                kalman_support_options)
+                kalman_support_options $<TARGET_NAME_IF_EXISTS:kalman_parallel>)
       separate_arguments(SAMPLE_COMMAND UNIX_COMMAND $ENV{COMMAND})
       add_test(
         NAME kalman_sample_${BACKEND}_${SAMPLE_NAME}
@@ -82,7 +82,8 @@ function(sample SAMPLE_NAME)
   endif()
 endfunction(sample)
 
-# Add a given test.
+# Add a given test. The tests run the concurrent loops on the thread pool, when
+# available.
 #
 # * NAME The name of the test file without extension.
 # * BACKENDS Optional list of backends to use against the test.
@@ -95,7 +96,8 @@ function(test TEST_NAME)
     add_executable(kalman_test_${TEST_NAME}_driver "${TEST_NAME}.cpp")
     target_link_libraries(
       kalman_test_${TEST_NAME}_driver
-      PRIVATE kalman kalman_main kalman_support_options kalman_unit_mp_units)
+      PRIVATE kalman kalman_main kalman_support_options kalman_unit_mp_units
+              $<TARGET_NAME_IF_EXISTS:kalman_parallel>)
     separate_arguments(TEST_COMMAND UNIX_COMMAND $ENV{COMMAND})
     add_test(NAME kalman_test_${TEST_NAME}
              COMMAND ${TEST_COMMAND}
@@ -113,7 +115,7 @@ function(test TEST_NAME)
       target_link_libraries(
         kalman_test_${BACKEND}_${TEST_NAME}_driver
         PRIVATE kalman kalman_main kalman_linalg_${BACKEND}
-                kalman_support_options)
+                kalman_support_options $<TARGET_NAME_IF_EXISTS:kalman_parallel>)
       separate_arguments(TEST_COMMAND UNIX_COMMAND $ENV{COMMAND})
       add_test(
         NAME kalman_test_${BACKEND}_${TEST_NAME}
@@ -122,3 +124,60 @@ function(test TEST_NAME)
     endforeach()
   endif()
 endfunction(test)
+
+# Add a given benchmark.
+#
+# * NAME The name of the benchmark file without extension.
+# * BACKENDS Optional list of backends to use against the benchmark. Without
+#   backends, the benchmark reports its own name as the backend label. The
+#   benchmarks of a backend run the concurrent loops on the thread pool, when
+#   available.
+function(benchmark BENCHMARK_NAME)
+  set(multiValueArgs BACKENDS)
+  cmake_parse_arguments(PARSE_ARGV 0 BENCHMARK "" "${oneValueArgs}"
+                        "${multiValueArgs}")
+  if(NOT BENCHMARK_BACKENDS)
+    add_executable(kalman_benchmark_${BENCHMARK_NAME}_driver
+                   "${BENCHMARK_NAME}.cpp")
+    target_compile_definitions(
+      kalman_benchmark_${BENCHMARK_NAME}_driver
+      PRIVATE "FCAROUGE_BENCHMARK_BACKEND=\"${BENCHMARK_NAME}\"")
+    target_link_libraries(
+      kalman_benchmark_${BENCHMARK_NAME}_driver
+      PRIVATE benchmark::benchmark_main kalman kalman_benchmark_options)
+    add_test(
+      NAME kalman_benchmark_${BENCHMARK_NAME}
+      COMMAND
+        $<TARGET_FILE:kalman_benchmark_${BENCHMARK_NAME}_driver>
+        "--benchmark_min_time=0.05s"
+        "--benchmark_out=kalman_benchmark_${BENCHMARK_NAME}.json"
+        "--benchmark_out_format=json")
+    set_property(GLOBAL APPEND
+                 PROPERTY KALMAN_BENCHMARK_DRIVERS
+                          kalman_benchmark_${BENCHMARK_NAME}_driver)
+  else()
+    foreach(BACKEND IN ITEMS ${BENCHMARK_BACKENDS})
+      add_executable(kalman_benchmark_${BACKEND}_${BENCHMARK_NAME}_driver
+                     "${BENCHMARK_NAME}.cpp")
+      target_compile_definitions(
+        kalman_benchmark_${BACKEND}_${BENCHMARK_NAME}_driver
+        PRIVATE "FCAROUGE_BENCHMARK_BACKEND=\"${BACKEND}\"")
+      target_link_libraries(
+        kalman_benchmark_${BACKEND}_${BENCHMARK_NAME}_driver
+        PRIVATE benchmark::benchmark_main kalman kalman_benchmark_options
+                kalman_linalg_${BACKEND}
+                $<TARGET_NAME_IF_EXISTS:kalman_parallel>)
+      add_test(
+        NAME kalman_benchmark_${BACKEND}_${BENCHMARK_NAME}
+        COMMAND
+          $<TARGET_FILE:kalman_benchmark_${BACKEND}_${BENCHMARK_NAME}_driver>
+          "--benchmark_min_time=0.05s"
+          "--benchmark_out=kalman_benchmark_${BACKEND}_${BENCHMARK_NAME}.json"
+          "--benchmark_out_format=json")
+      set_property(
+        GLOBAL APPEND
+        PROPERTY KALMAN_BENCHMARK_DRIVERS
+                 kalman_benchmark_${BACKEND}_${BENCHMARK_NAME}_driver)
+    endforeach()
+  endif()
+endfunction(benchmark)
@@ -0,0 +1,100 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/kalman.hpp"
+#include "fcarouge/kalman_adaptive.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <cmath>
+
+namespace fcarouge::test {
+namespace {
+template <auto Size> using vector = column_vector<double, Size>;
+template <auto Row, auto Column> using matrix = matrix<double, Row, Column>;
+
+//! @test Verifies the Sage-Husa and covariance matching adaptive decorators
+//! estimate the output uncertainty of a constant velocity track from a wrong
+//! initial value, and the covariance matching the process uncertainty.
+[[maybe_unused]] const auto test{[] {
+  const double noise[]{2., -2., -2., 2., 2., 2., -2., -2.};
+
+  auto husa{kalman{state{vector<2>{0., 1.}},
+                   output<vector<1>>,
+                   estimate_uncertainty{{1., 0.}, {0., 1.}},
+                   process_uncertainty{{0.01, 0.}, {0., 0.01}},
+                   output_uncertainty{0.5},
+                   output_model{matrix<1, 2>{{1., 0.}}},
+                   state_transition{matrix<2, 2>{{1., 1.}, {0., 1.}}}} |
+            sage_husa{.forgetting = 0.99}};
+
+  auto matching{kalman{state{vector<2>{0., 1.}},
+                       output<vector<1>>,
+                       estimate_uncertainty{{1., 0.}, {0., 1.}},
+                       process_uncertainty{{0.01, 0.}, {0., 0.01}},
+                       output_uncertainty{4.},
+                       output_model{matrix<1, 2>{{1., 0.}}},
+                       state_transition{matrix<2, 2>{{1., 1.}, {0., 1.}}}} |
+                covariance_matching{.forgetting = 0.99, .q = true, .r = false}};
+
+  husa.predict();
+  husa.update(1. + noise[1]);
+  [[maybe_unused]] const double y{husa.y()(0)};
+  assert(std::abs(husa.r()(0) - (0.5 + y * y - husa.s()(0))) < 1e-9 &&
+         "The first update weighs the innovation fully.");
+
+  for (int step{2}; step <= 1000; ++step) {
+    husa.predict();
+    husa.update(step + noise[step % 8]);
+  }
+  for (int step{1}; step <= 1000; ++step) {
+    matching.predict();
+    matching.update(step + noise[step % 8]);
+  }
+
+  assert(std::abs(husa.r()(0) - 4.) < 0.1 &&
+         "The output uncertainty converges to the noise variance.");
+  assert(husa.q()(0, 0) == 0.01 && husa.q()(1, 1) == 0.01 &&
+         "The process uncertainty is not adapted by default.");
+  assert(matching.r()(0) == 4. && matching.q()(1, 1) < 0.001 &&
+         "The velocity process uncertainty vanishes for a constant velocity.");
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
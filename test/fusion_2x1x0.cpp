@@ -0,0 +1,118 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/kalman.hpp"
+#include "fcarouge/kalman_fusion.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <cstddef>
+
+namespace fcarouge::test {
+namespace {
+template <auto Size> using vector = column_vector<double, Size>;
+template <auto Row, auto Column> using matrix = matrix<double, Row, Column>;
+
+struct position_sensor {};
+struct odometry_sensor {};
+
+//! @test Verifies the fusion front-end merging the measurements of three
+//! sensor queues produces the estimates of the filter driven in timestamp
+//! order, each queue updating the filter with its named sensor and output.
+[[maybe_unused]] const auto test{[] {
+  const sensor position{name<position_sensor>, output<vector<1>>,
+                        output_model{matrix<1, 2>{{1., 0.}}},
+                        output_uncertainty{1.}};
+  const sensor odometry{name<odometry_sensor>, output<vector<2>>,
+                        output_model{matrix<2, 2>{{1., 0.}, {0., 1.}}},
+                        output_uncertainty{{1., 0.}, {0., 0.5}}};
+  const auto declare{[&position, &odometry] {
+    return kalman{state{vector<2>{0., 0.}},
+                  estimate_uncertainty{{10., 0.}, {0., 10.}},
+                  process_uncertainty{{0.01, 0.}, {0., 0.01}},
+                  state_transition{[](const double &delta_time) {
+                    return matrix<2, 2>{{1., delta_time}, {0., 1.}};
+                  }},
+                  prediction_types<double>,
+                  position,
+                  odometry};
+  }};
+  auto driven{declare()};
+  auto fused{declare()};
+
+  fusion node{fused, 0., position, position, odometry};
+
+  for (int i{1}; i <= 20; ++i) {
+    node.push<1>(0.5 * i, 1.0 * i);
+  }
+  for (int i{1}; i <= 100; ++i) {
+    node.push<0>(0.1 * i, 0.2 * i);
+  }
+
+  [[maybe_unused]] const std::size_t processed{node.process(10.)};
+  assert(processed == 120);
+  assert(node.time() == 10.);
+
+  double now{0.};
+  for (int i{1}; i <= 100; ++i) {
+    const double time{0.1 * i};
+    driven.predict(time - now);
+    now = time;
+    driven.update<position_sensor>(0.2 * i);
+    if (i % 5 == 0) {
+      driven.update<position_sensor>(0.2 * i);
+    }
+  }
+
+  assert(fused.x().isApprox(driven.x()));
+  assert(fused.p().isApprox(driven.p()));
+
+  node.push<2>(10.5, 21., 2.);
+  assert(node.process(10.) == 0);
+  assert(node.process(11.) == 1);
+  assert(node.time() == 10.5);
+
+  driven.predict(0.5);
+  driven.update<odometry_sensor>(21., 2.);
+  assert(fused.x().isApprox(driven.x()));
+  assert(fused.p().isApprox(driven.p()));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,103 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/kalman.hpp"
+#include "fcarouge/kalman_imm.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <cmath>
+
+namespace fcarouge::test {
+namespace {
+template <auto Size> using vector = column_vector<double, Size>;
+template <auto Row, auto Column> using matrix = matrix<double, Row, Column>;
+
+//! @test Verifies the interacting multiple model estimates of identical modes
+//! are the estimates of their filter, and that the mode probabilities follow
+//! the maneuvers.
+[[maybe_unused]] const auto test{[] {
+  const matrix<2, 2> f{{1., 0.5}, {0., 1.}};
+  const matrix<1, 2> h{{1., 0.}};
+  const auto filter{[&f, &h](double q) {
+    return kalman{state{vector<2>{1., 2.}},
+                  output<vector<1>>,
+                  estimate_uncertainty{{10., 1.}, {1., 5.}},
+                  process_uncertainty{{q, 0.}, {0., q}},
+                  output_uncertainty{4.},
+                  output_model{h},
+                  state_transition{f}};
+  }};
+
+  auto single{filter(0.1)};
+  imm identical{filter(0.1), filter(0.1)};
+  identical.pi() = {{{0.9, 0.1}, {0.2, 0.8}}};
+
+  for (int i{0}; i < 20; ++i) {
+    single.predict();
+    identical.predict();
+    single.update(0.3 * i);
+    identical.update(0.3 * i);
+  }
+
+  assert(identical.x().isApprox(single.x()));
+  assert(identical.p().isApprox(single.p()));
+  assert(std::abs(identical.mu()[0] - 2. / 3.) < 1e-3);
+
+  imm maneuvering{filter(0.01), filter(2.)};
+  maneuvering.pi() = {{{0.95, 0.05}, {0.05, 0.95}}};
+
+  for (int i{0}; i < 15; ++i) {
+    maneuvering.predict();
+    maneuvering.update(0.5 * i);
+  }
+
+  assert(maneuvering.mu()[0] > maneuvering.mu()[1]);
+
+  for (int i{15}; i < 30; ++i) {
+    maneuvering.predict();
+    maneuvering.update(0.5 * i + (i - 15) * (i - 15));
+  }
+
+  assert(maneuvering.mu()[1] > maneuvering.mu()[0]);
+  assert(std::abs(maneuvering.mu()[0] + maneuvering.mu()[1] - 1.) < 1e-12);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,99 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/kalman.hpp"
+#include "fcarouge/kalman_gating.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <span>
+
+namespace fcarouge::test {
+namespace {
+template <auto Size> using vector = column_vector<double, Size>;
+template <auto Row, auto Column> using matrix = matrix<double, Row, Column>;
+
+//! @test Verifies the probabilistic association update of a certain candidate
+//! is the update of the candidate, and the update of several candidates
+//! combines their innovations and their spread.
+[[maybe_unused]] const auto test{[] {
+  const auto filter{
+      kalman{
+          state{vector<3>{1., 2., 3.}},
+          output<vector<2>>,
+          estimate_uncertainty{{2., 0.3, 0.1}, {0.3, 1., 0.2}, {0.1, 0.2, 3.}},
+          process_uncertainty{{0.1, 0., 0.}, {0., 0.1, 0.}, {0., 0., 0.1}},
+          output_uncertainty{{0.5, 0.1}, {0.1, 0.4}},
+          output_model{matrix<2, 3>{{1., 0., 1.}, {0., 1., 0.5}}},
+          state_transition{
+              matrix<3, 3>{{1., 0.1, 0.}, {0., 1., 0.1}, {0., 0., 1.}}}} |
+      gating};
+
+  const vector<2> candidates[]{vector<2>{4., 3.}, vector<2>{5., 2.}};
+
+  auto certain{filter};
+  const double certainty[]{1.};
+  certain.associate(std::span{candidates, 1}, certainty);
+  auto updated{filter};
+  updated.update(candidates[0]);
+  assert(certain.x().isApprox(updated.x()));
+  assert(certain.p().isApprox(updated.p()));
+
+  auto associated{filter};
+  const double probabilities[]{0.5, 0.3};
+  associated.associate(candidates, probabilities);
+  const matrix<2, 2> s{filter.h() * filter.p() * filter.h().transpose() +
+                       filter.r()};
+  const matrix<3, 2> k{filter.p() * filter.h().transpose() * s.inverse()};
+  const vector<2> y0{candidates[0] - filter.h() * filter.x()};
+  const vector<2> y1{candidates[1] - filter.h() * filter.x()};
+  const vector<2> y{0.5 * y0 + 0.3 * y1};
+  [[maybe_unused]] const vector<3> expected_x{filter.x() + k * y};
+  [[maybe_unused]] const matrix<3, 3> expected_p{
+      0.2 * filter.p() + 0.8 * (filter.p() - k * s * k.transpose()) +
+      k *
+          (0.5 * y0 * y0.transpose() + 0.3 * y1 * y1.transpose() -
+           y * y.transpose()) *
+          k.transpose()};
+  assert(associated.x().isApprox(expected_x));
+  assert(associated.p().isApprox(expected_p));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,90 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/kalman.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <cmath>
+
+namespace fcarouge::test {
+namespace {
+template <auto Size> using vector = column_vector<double, Size>;
+template <auto Row, auto Column> using matrix = matrix<double, Row, Column>;
+
+//! @test Verifies the equality constraint projects the updated estimate on the
+//! constraint with the precomputed projector, and the violated inequality
+//! constraint is activated and enforced.
+[[maybe_unused]] const auto test{[] {
+  kalman filter{
+      state{vector<2>{0., 0.}},
+      output<vector<2>>,
+      estimate_uncertainty{{1., 0.}, {0., 1.}},
+      process_uncertainty{{0.1, 0.}, {0., 0.1}},
+      output_uncertainty{{1., 0.}, {0., 1.}},
+      output_model{matrix<2, 2>{{1., 0.}, {0., 1.}}},
+      state_transition{matrix<2, 2>{{1., 0.}, {0., 1.}}},
+      equality_constraint{matrix<1, 2>{{1., -1.}}, vector<1>{0.}},
+      inequality_constraint{matrix<1, 2>{{0., 1.}}, vector<1>{3.}}};
+
+  filter.predict();
+  filter.update(2., 1.);
+
+  // The unconstrained estimate is the measurement weighted by the gain
+  // `1.1 / 2.1`, projected on the `x0 = x1` line.
+  [[maybe_unused]] const double gain{1.1 / 2.1};
+  assert(std::abs(filter.x()(0) - 1.5 * gain) < 1e-9);
+  assert(std::abs(filter.x()(1) - 1.5 * gain) < 1e-9);
+  assert(std::abs(filter.p()(0, 0) - gain / 2.) < 1e-9);
+  assert(std::abs(filter.p()(0, 1) - gain / 2.) < 1e-9);
+  assert(std::abs(filter.p()(1, 1) - gain / 2.) < 1e-9);
+
+  filter.predict();
+  filter.update(9., 8.);
+
+  assert(std::abs(filter.x()(0) - 3.) < 1e-9 &&
+         "The inequality constraint is active on the line.");
+  assert(std::abs(filter.x()(1) - 3.) < 1e-9);
+  assert(std::abs(filter.p()(0, 0)) < 1e-9 &&
+         std::abs(filter.p()(1, 1)) < 1e-9 &&
+         "The active constraints determine the state.");
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,87 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/kalman.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+
+namespace fcarouge::test {
+namespace {
+template <auto Size> using vector = column_vector<double, Size>;
+template <auto Row, auto Column> using matrix = matrix<double, Row, Column>;
+
+//! @test Verifies the cubature filter estimates match the linear filter
+//! estimates for linear models, with a scalar-point transition callable and a
+//! batched observation callable returning an unevaluated expression.
+[[maybe_unused]] const auto test{[] {
+  const matrix<2, 2> f{{1., 0.5}, {0., 1.}};
+  const matrix<1, 2> h{{1., 0.}};
+
+  kalman linear{state{vector<2>{1., 2.}},
+                output<vector<1>>,
+                estimate_uncertainty{{10., 1.}, {1., 5.}},
+                process_uncertainty{{0.1, 0.02}, {0.02, 0.2}},
+                output_uncertainty{4.},
+                output_model{h},
+                state_transition{f}};
+
+  kalman cubature{
+      state{vector<2>{1., 2.}},
+      output<vector<1>>,
+      estimate_uncertainty{{10., 1.}, {1., 5.}},
+      process_uncertainty{{0.1, 0.02}, {0.02, 0.2}},
+      output_uncertainty{4.},
+      transition{[&f](const vector<2> &x) -> vector<2> { return f * x; }},
+      observation{[&h](const matrix<2, 4> &x) { return h * x; }},
+      cubature_points<double>};
+
+  for (int i{0}; i < 20; ++i) {
+    linear.predict();
+    cubature.predict();
+    linear.update(0.3 * i);
+    cubature.update(0.3 * i);
+
+    assert(cubature.x().isApprox(linear.x(), 1e-9));
+    assert(cubature.p().isApprox(linear.p(), 1e-9));
+  }
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,107 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/kalman.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+
+namespace fcarouge::test {
+namespace {
+template <auto Size> using vector = column_vector<double, Size>;
+template <auto Row, auto Column> using matrix = matrix<double, Row, Column>;
+
+//! @test Verifies the extended filter derives the output model H and the state
+//! transition F Jacobians of a pendulum from the generic observation and
+//! transition functions by automatic differentiation.
+[[maybe_unused]] const auto test{[] {
+  const double gravity{9.81};
+
+  kalman filter{
+      state{vector<2>{0.5, 0.}},
+      output<double>,
+      estimate_uncertainty{{0.1, 0.}, {0., 0.1}},
+      process_uncertainty{{0.0001, 0.}, {0., 0.0001}},
+      output_uncertainty{0.0001},
+      transition{[gravity](const auto &x, const double &period) {
+        using std::sin;
+        const auto &[angle, rate]{x};
+        using scalar = std::remove_cvref_t<decltype(angle)>;
+
+        return column_vector<scalar, 2>{angle + rate * period,
+                                        rate - gravity * sin(angle) * period};
+      }},
+      observation{[](const auto &x) {
+        using std::sin;
+        return sin(x(0));
+      }},
+      update_types<>,
+      prediction_types<double>};
+
+  double angle{0.5};
+  double rate{0.};
+  for (int i{0}; i < 100; ++i) {
+    const vector<2> prior{filter.x()};
+    filter.predict(0.01);
+
+    [[maybe_unused]] const matrix<2, 2> f{
+        {1., 0.01}, {-gravity * std::cos(prior(0)) * 0.01, 1.}};
+    assert(filter.f().isApprox(f, 1e-15) &&
+           "The state transition is the exact Jacobian of the transition.");
+
+    const vector<2> predicted{filter.x()};
+    const double acceleration{-gravity * std::sin(angle)};
+    angle += rate * 0.01;
+    rate += acceleration * 0.01;
+    filter.update(std::sin(angle));
+
+    [[maybe_unused]] const matrix<1, 2> h{{std::cos(predicted(0)), 0.}};
+    assert(filter.h().isApprox(h, 1e-15) &&
+           "The output model is the exact Jacobian of the observation.");
+  }
+
+  assert(std::abs(filter.x()(0) - angle) < 0.001 &&
+         std::abs(filter.x()(1) - rate) < 0.01 &&
+         "The estimated state tracks the swinging pendulum.");
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,105 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "fcarouge/kalman.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+
+namespace fcarouge::test {
+namespace {
+template <auto Size> using vector = column_vector<double, Size>;
+template <auto Row, auto Column> using matrix = matrix<double, Row, Column>;
+
+//! @test Verifies the ensemble filter estimates of a three-dimensional
+//! constant velocity model approach the linear filter estimates, with the
+//! diagonal uncertainties sampled by scaling and the process and output
+//! uncertainties changed and factored again mid-way.
+[[maybe_unused]] const auto test{[] {
+  const matrix<6, 6> i{kalman_internal::one<matrix<6, 6>>};
+  const matrix<6, 6> f{{1., 0., 0., 0.1, 0., 0.}, {0., 1., 0., 0., 0.1, 0.},
+                       {0., 0., 1., 0., 0., 0.1}, {0., 0., 0., 1., 0., 0.},
+                       {0., 0., 0., 0., 1., 0.},  {0., 0., 0., 0., 0., 1.}};
+  const matrix<2, 6> h{{1., 0., 0., 0., 0., 0.}, {0., 1., 0., 0., 0., 0.}};
+  const vector<6> x{kalman_internal::zero<vector<6>>};
+
+  kalman linear{state{x},
+                output<vector<2>>,
+                estimate_uncertainty{4. * i},
+                process_uncertainty{0.01 * i},
+                output_uncertainty{{0.5, 0.}, {0., 0.5}},
+                output_model{h},
+                state_transition{f}};
+
+  kalman ensembled{
+      state{x},
+      output<vector<2>>,
+      estimate_uncertainty{4. * i},
+      process_uncertainty{0.01 * i},
+      output_uncertainty{{0.5, 0.}, {0., 0.5}},
+      transition{[&f](const vector<6> &state_x) -> vector<6> {
+        return f * state_x;
+      }},
+      observation{[&h](const vector<6> &state_x) -> vector<2> {
+        return h * state_x;
+      }},
+      ensemble<double, 4000>};
+
+  for (int step{0}; step < 30; ++step) {
+    if (step == 15) {
+      const matrix<6, 6> q{0.02 * i};
+      const matrix<2, 2> r{{1., 0.2}, {0.2, 1.}};
+      linear.q(q);
+      ensembled.q(q);
+      linear.r(r);
+      ensembled.r(r);
+    }
+    const vector<2> z{0.1 * step, 0.005 * step * step};
+    linear.predict();
+    ensembled.predict();
+    linear.update(z);
+    ensembled.update(z);
+  }
+
+  assert(ensembled.q() == linear.q());
+  assert(ensembled.x().isApprox(linear.x(), 0.1));
+  assert(ensembled.p().isApprox(linear.p(), 0.1));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
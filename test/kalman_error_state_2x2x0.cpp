@@ -0,0 +1,104 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/kalman.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <cmath>
+
+namespace fcarouge::test {
+namespace {
+template <auto Size> using vector = column_vector<double, Size>;
+template <auto Row, auto Column> using matrix = matrix<double, Row, Column>;
+
+//! @test Verifies the error-state filter tracks a heading on the unit circle,
+//! with a nominal state of two elements, a one element error state, and the
+//! estimate uncertainty of the error.
+[[maybe_unused]] const auto test{[] {
+  const auto rotate{[](const vector<2> &heading, double angle) {
+    const double c{std::cos(angle)};
+    const double s{std::sin(angle)};
+    return vector<2>{c * heading(0) - s * heading(1),
+                     s * heading(0) + c * heading(1)};
+  }};
+
+  kalman filter{
+      state{vector<2>{1., 0.}},
+      error_state<vector<1>>,
+      output<vector<2>>,
+      estimate_uncertainty{1.},
+      process_uncertainty{0.0001},
+      output_uncertainty{{0.01, 0.}, {0., 0.01}},
+      output_model{[](const vector<2> &x) {
+        return matrix<2, 1>{{-x(1)}, {x(0)}};
+      }},
+      state_transition{[]([[maybe_unused]] const vector<2> &x,
+                          [[maybe_unused]] const double &rate,
+                          [[maybe_unused]] const double &period) {
+        return matrix<1, 1>{1.};
+      }},
+      transition{[&rotate](const vector<2> &x, const double &rate,
+                           const double &period) {
+        return rotate(x, rate * period);
+      }},
+      observation{[](const vector<2> &x) { return x; }},
+      retraction{[&rotate](const vector<2> &x, const vector<1> &dx) {
+        return rotate(x, dx(0));
+      }},
+      prediction_types<double, double>};
+
+  double heading{1.};
+  for (int i{0}; i < 50; ++i) {
+    heading += 0.01;
+    filter.predict(0.1, 0.1);
+    const double noise{0.05 * (i % 3 - 1)};
+    filter.update(std::cos(heading + noise), std::sin(heading + noise));
+  }
+
+  assert(std::abs(std::atan2(filter.x()(1), filter.x()(0)) - heading) < 0.01 &&
+         "The estimated heading converges.");
+  assert(std::abs(filter.x().norm() - 1.) < 1e-9 &&
+         "The nominal state remains on the unit circle.");
+  assert(filter.p()(0, 0) > 0. && filter.p()(0, 0) < 0.001 &&
+         "The error state uncertainty is of minimal dimension.");
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
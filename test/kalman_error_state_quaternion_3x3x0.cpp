@@ -0,0 +1,102 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+#include "fcarouge/kalman.hpp"
+#include "fcarouge/lie.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <cmath>
+
+namespace fcarouge::test {
+namespace {
+template <auto Size> using vector = column_vector<double, Size>;
+template <auto Row, auto Column> using matrix = matrix<double, Row, Column>;
+using eigen::quaternion;
+
+//! @test Verifies the error-state filter tracks a rotating attitude, with a
+//! unit quaternion nominal state, a three element rotation vector error state,
+//! and attitude measurements compared in the tangent space.
+[[maybe_unused]] const auto test{[] {
+  const matrix<3, 3> i{kalman_internal::one<matrix<3, 3>>};
+
+  kalman filter{
+      state{quaternion<>{}},
+      error_state<vector<3>>,
+      output<quaternion<>>,
+      estimate_uncertainty{0.5 * i},
+      process_uncertainty{0.0001 * i},
+      output_uncertainty{0.0004 * i},
+      output_model{[&i]([[maybe_unused]] const quaternion<> &x) { return i; }},
+      state_transition{[]([[maybe_unused]] const quaternion<> &x,
+                          const vector<3> &rate, const double &period) {
+        return matrix<3, 3>{
+            quaternion<>::exp(vector<3>{rate * period}).inverse().adjoint()};
+      }},
+      transition{[](const quaternion<> &x, const vector<3> &rate,
+                    const double &period) {
+        return x.plus(vector<3>{rate * period});
+      }},
+      observation{[](const quaternion<> &x) { return x; }},
+      retraction{[](const quaternion<> &x, const vector<3> &dx) {
+        return x.plus(dx);
+      }},
+      local{[](const quaternion<> &z, const quaternion<> &predicted) {
+        return z.minus(predicted);
+      }},
+      prediction_types<vector<3>, double>};
+
+  const vector<3> rate{0.2, -0.1, 0.3};
+  quaternion<> attitude{quaternion<>::exp(vector<3>{0.5, -0.3, 0.2})};
+  for (int step{0}; step < 50; ++step) {
+    attitude = attitude.plus(vector<3>{rate * 0.1});
+    filter.predict(rate, 0.1);
+    const double noise{0.01 * (step % 3 - 1)};
+    filter.update(attitude.plus(vector<3>{noise, -noise, noise}));
+  }
+
+  assert(filter.x().minus(attitude).norm() < 0.01 &&
+         "The estimated attitude converges.");
+  assert(std::abs(filter.x().data().norm() - 1.) < 1e-9 &&
+         "The nominal state remains a unit quaternion.");
+  assert(filter.p()(0, 0) > 0. && filter.p()(0, 0) < 0.001 &&
+         "The error state uncertainty is of minimal dimension.");
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
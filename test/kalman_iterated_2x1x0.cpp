@@ -0,0 +1,124 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/kalman.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <cmath>
+
+namespace fcarouge::test {
+namespace {
+template <auto Size> using vector = column_vector<double, Size>;
+template <auto Row, auto Column> using matrix = matrix<double, Row, Column>;
+
+//! @test Verifies the iterated extended filter update of a range measurement
+//! converges to the maximum a posteriori estimate, the minimum of
+//! `(X - X₀)ᵀ * P₀⁻¹ * (X - X₀) + (Z - h(X))ᵀ * R⁻¹ * (Z - h(X))`, where a
+//! single linearization does not.
+[[maybe_unused]] const auto test{[] {
+  const auto stay{[](const auto &x) { return x; }};
+  const auto range{[](const auto &x) {
+    using std::sqrt;
+    return sqrt(x(0) * x(0) + x(1) * x(1));
+  }};
+  const vector<2> prior{4., 3.};
+  const matrix<2, 2> p{{4., 0.}, {0., 1.}};
+  const double r{0.01};
+  const double measured{7.};
+
+  kalman extended{state{prior},
+                  output<double>,
+                  estimate_uncertainty{p},
+                  process_uncertainty{{0., 0.}, {0., 0.}},
+                  output_uncertainty{r},
+                  transition{stay},
+                  observation{range}};
+  kalman single{state{prior},
+                output<double>,
+                estimate_uncertainty{p},
+                process_uncertainty{{0., 0.}, {0., 0.}},
+                output_uncertainty{r},
+                transition{stay},
+                observation{range},
+                iterations{1, 0.}};
+  kalman none{state{prior},
+              output<double>,
+              estimate_uncertainty{p},
+              process_uncertainty{{0., 0.}, {0., 0.}},
+              output_uncertainty{r},
+              transition{stay},
+              observation{range},
+              iterations{0, 0.}};
+  kalman iterated{state{prior},
+                  output<double>,
+                  estimate_uncertainty{p},
+                  process_uncertainty{{0., 0.}, {0., 0.}},
+                  output_uncertainty{r},
+                  transition{stay},
+                  observation{range},
+                  iterations{50, 1e-12}};
+
+  extended.update(measured);
+  single.update(measured);
+  none.update(measured);
+  iterated.update(measured);
+
+  assert(single.x() == extended.x() && single.p() == extended.p() &&
+         "One iteration is the extended filter update.");
+  assert(none.x() == extended.x() && none.p() == extended.p() &&
+         "No iteration is still one linearization of the update.");
+
+  const auto gradient{[&](const vector<2> &x) {
+    const double norm{range(x)};
+    const vector<2> h{x / norm};
+    return vector<2>{p.inverse() * (x - prior) - h * (measured - norm) / r};
+  }};
+
+  assert(gradient(iterated.x()).norm() < 1e-6 &&
+         "The iterated update is the maximum a posteriori estimate.");
+  assert(gradient(extended.x()).norm() > 1. &&
+         "The single linearization is not the maximum a posteriori estimate.");
+  assert(std::abs(range(iterated.x()) - measured) <
+             std::abs(range(extended.x()) - measured) &&
+         "The iterated update is closer to the measurement.");
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
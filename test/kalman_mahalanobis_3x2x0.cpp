@@ -0,0 +1,111 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/kalman.hpp"
+#include "fcarouge/kalman_gating.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+
+namespace fcarouge::test {
+namespace {
+template <auto Size> using vector = column_vector<double, Size>;
+template <auto Row, auto Column> using matrix = matrix<double, Row, Column>;
+
+//! @test Verifies the squared Mahalanobis distances and log-likelihoods of a
+//! batch of candidates against the innovation uncertainty computed directly,
+//! before and after a prediction, an update, and changes of the output and
+//! estimate uncertainties without a prediction in between.
+[[maybe_unused]] const auto test{[] {
+  auto filter{
+      kalman{
+          state{vector<3>{1., 2., 3.}},
+          output<vector<2>>,
+          estimate_uncertainty{{2., 0.3, 0.1}, {0.3, 1., 0.2}, {0.1, 0.2, 3.}},
+          process_uncertainty{{0.1, 0., 0.}, {0., 0.1, 0.}, {0., 0., 0.1}},
+          output_uncertainty{{0.5, 0.1}, {0.1, 0.4}},
+          output_model{matrix<2, 3>{{1., 0., 1.}, {0., 1., 0.5}}},
+          state_transition{
+              matrix<3, 3>{{1., 0.1, 0.}, {0., 1., 0.1}, {0., 0., 1.}}}} |
+      gating};
+
+  const vector<2> candidates[]{vector<2>{4., 3.}, vector<2>{0., 0.},
+                               vector<2>{10., -3.}, vector<2>{4.5, 2.5}};
+  const auto &observed{filter};
+  const auto verify{[&] {
+    double distances[4]{};
+    double likelihoods[4]{};
+    filter.mahalanobis(candidates, distances, likelihoods);
+
+    const matrix<2, 2> s{observed.h() * observed.p() *
+                             observed.h().transpose() +
+                         observed.r()};
+    for (std::size_t index{0}; index < 4; ++index) {
+      const vector<2> y{candidates[index] - observed.h() * observed.x()};
+      [[maybe_unused]] const double expected_distance{y.dot(s.inverse() * y)};
+      [[maybe_unused]] const double expected_likelihood{
+          -(expected_distance + std::log(s.determinant()) +
+            2. * std::log(2. * std::numbers::pi)) /
+          2.};
+      assert(std::abs(distances[index] - expected_distance) < 1e-9);
+      assert(std::abs(likelihoods[index] - expected_likelihood) < 1e-9);
+    }
+  }};
+
+  verify();
+  filter.predict();
+  verify();
+  filter.update(4., 3.);
+  verify();
+
+  // The writes refactor the cached innovation uncertainty without a
+  // prediction in between, including from linear algebra expressions.
+  filter.r(matrix<2, 2>{{2., 0.}, {0., 1.}});
+  verify();
+  filter.r(2. * observed.r());
+  verify();
+  filter.p(0.5 * observed.p());
+  verify();
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
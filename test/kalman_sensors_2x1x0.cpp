@@ -0,0 +1,106 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/kalman.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+
+namespace fcarouge::test {
+namespace {
+template <auto Size> using vector = column_vector<double, Size>;
+template <auto Row, auto Column> using matrix = matrix<double, Row, Column>;
+
+struct position_sensor {};
+struct odometry_sensor {};
+
+//! @test Verifies the named sensors updates of one filter produce the estimates
+//! of the filters of each measurement model sharing their state.
+[[maybe_unused]] const auto test{[] {
+  const matrix<2, 2> f{{1., 0.5}, {0., 1.}};
+  const matrix<1, 2> position_h{{1., 0.}};
+  const matrix<2, 2> odometry_h{{1., 0.}, {0., 1.}};
+  const matrix<2, 2> odometry_r{{1., 0.}, {0., 0.25}};
+
+  kalman filter{state{vector<2>{0., 0.}},
+                estimate_uncertainty{{10., 0.}, {0., 10.}},
+                process_uncertainty{{0.01, 0.}, {0., 0.01}},
+                state_transition{f},
+                sensor{name<position_sensor>, output<vector<1>>,
+                       output_model{position_h}, output_uncertainty{4.}},
+                sensor{name<odometry_sensor>, output<vector<2>>,
+                       output_model{odometry_h},
+                       output_uncertainty{odometry_r}}};
+
+  kalman position{state{vector<2>{0., 0.}},
+                  output<vector<1>>,
+                  estimate_uncertainty{{10., 0.}, {0., 10.}},
+                  process_uncertainty{{0.01, 0.}, {0., 0.01}},
+                  output_uncertainty{4.},
+                  output_model{position_h},
+                  state_transition{f}};
+  kalman odometry{state{vector<2>{0., 0.}},
+                  output<vector<2>>,
+                  estimate_uncertainty{{10., 0.}, {0., 10.}},
+                  process_uncertainty{{0.01, 0.}, {0., 0.01}},
+                  output_uncertainty{odometry_r},
+                  output_model{odometry_h},
+                  state_transition{f}};
+
+  for (int i{1}; i <= 50; ++i) {
+    filter.predict();
+    filter.update<position_sensor>(1. * i);
+    position.predict();
+    position.update(1. * i);
+    if (i % 3 == 0) {
+      filter.update<odometry_sensor>(1. * i, 2.);
+      odometry.x(position.x());
+      odometry.p(position.p());
+      odometry.update(1. * i, 2.);
+      position.x(odometry.x());
+      position.p(odometry.p());
+    }
+  }
+
+  assert(filter.x().isApprox(position.x()));
+  assert(filter.p().isApprox(position.p()));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
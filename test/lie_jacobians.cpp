@@ -0,0 +1,111 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/lie.hpp"
+
+#include <cassert>
+#include <numbers>
+
+namespace fcarouge::test {
+namespace {
+//! @test Verifies the exponential and logarithm maps are inverse, and the
+//! closed-form Jacobians match the numerical differentiation of the maps, for
+//! the rotations, unit quaternions, and rigid motions.
+template <typename Group>
+auto verify(const typename Group::tangent &tau) -> bool {
+  using tangent = Group::tangent;
+  using jacobian = Group::jacobian;
+  const double step{1e-6};
+  const Group x{Group::exp(tau)};
+  jacobian right;
+  jacobian left;
+  jacobian inverse;
+
+  for (int index{0}; index < tangent::RowsAtCompileTime; ++index) {
+    tangent e{tangent::Zero()};
+    e(index) = step;
+    const Group y{Group::exp(tangent{tau + e})};
+    right.col(index) = (x.inverse() * y).log() / step;
+    left.col(index) = (y * x.inverse()).log() / step;
+    inverse.col(index) = (x.plus(e).log() - tau) / step;
+  }
+
+  return (x.log() - tau).norm() < 1e-12 &&
+         right.isApprox(Group::right_jacobian(tau), 1e-5) &&
+         left.isApprox(Group::left_jacobian(tau), 1e-5) &&
+         inverse.isApprox(Group::right_jacobian_inverse(tau), 1e-5) &&
+         (Group::left_jacobian(tau) * Group::left_jacobian_inverse(tau))
+             .isIdentity(1e-12);
+}
+
+[[maybe_unused]] const auto test{[] {
+  using eigen::quaternion;
+  using eigen::se3;
+  using eigen::so3;
+
+  for (double scale : {1.2, 0.3, 0.01, 1e-5}) {
+    assert(verify<so3<>>(
+        so3<>::tangent{0.3 * scale, -0.5 * scale, 0.8 * scale}));
+    assert(verify<quaternion<>>(
+        quaternion<>::tangent{0.3 * scale, -0.5 * scale, 0.8 * scale}));
+    assert(verify<se3<>>(
+        se3<>::tangent{1., -2., 0.5, 0.3 * scale, -0.5 * scale, 0.8 * scale}));
+  }
+
+  const so3<>::tangent half_turn{0., std::numbers::pi, 0.};
+  assert((so3<>::right_jacobian(half_turn) *
+          so3<>::right_jacobian_inverse(half_turn))
+             .isIdentity(1e-12) &&
+         "The inverse Jacobian is defined at the half turn.");
+
+  const se3<> motion{se3<>::exp(se3<>::tangent{1., 2., 3., 0.1, 0.2, 0.3})};
+  const se3<>::tangent delta{0.01, 0.02, -0.03, 0.04, 0.05, -0.01};
+  assert((motion * se3<>::exp(delta))
+             .minus(se3<>::exp(se3<>::tangent{motion.adjoint() * delta}) *
+                    motion)
+             .norm() < 1e-12 &&
+         "The adjoint moves the perturbation to the left.");
+
+  assert(kalman_internal::one<quaternion<>> == quaternion<>{});
+  assert(kalman_internal::zero<so3<>> == so3<>{});
+  assert((kalman_internal::t(motion) * motion).log().norm() < 1e-12);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,87 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+
+namespace fcarouge::test {
+namespace {
+template <typename Scalar, auto State, auto Output> void verify() {
+  using estimate_uncertainty = matrix<Scalar, State, State>;
+  using output_model = matrix<Scalar, Output, State>;
+  using output_uncertainty = matrix<Scalar, Output, Output>;
+  using gain = matrix<Scalar, State, Output>;
+
+  const estimate_uncertainty f{estimate_uncertainty::Random()};
+  const estimate_uncertainty root{estimate_uncertainty::Random()};
+  const estimate_uncertainty p{root * root.transpose()};
+  const estimate_uncertainty q{estimate_uncertainty::Identity()};
+  const output_model h{output_model::Random()};
+  const output_uncertainty r{output_uncertainty::Identity()};
+  const output_uncertainty s{h * p * h.transpose() + r};
+  const gain k{kalman_internal::weigh(p, h, s)};
+  const estimate_uncertainty a{estimate_uncertainty::Identity() - k * h};
+
+  const estimate_uncertainty propagated{kalman_internal::propagate(f, p, q)};
+  const estimate_uncertainty corrected{kalman_internal::correct(a, p, k, r)};
+
+  assert(propagated.isApprox(estimate_uncertainty{f * p * f.transpose() + q}));
+  assert(corrected.isApprox(estimate_uncertainty{
+      a * p * a.transpose() + k * r * k.transpose()}));
+  assert(k.isApprox(gain{s.transpose()
+                             .fullPivHouseholderQr()
+                             .solve(gain{p * h.transpose()}.transpose())
+                             .transpose()}));
+}
+
+//! @test Verifies the dispatched propagation, correction, and gain kernels are
+//! equivalent to the Eigen3 expressions, for the smallest dispatched and larger
+//! numbers of states, and for a single and several outputs.
+[[maybe_unused]] const auto test{[] {
+  verify<float, 8, 1>();
+  verify<double, 8, 1>();
+  verify<float, 9, 3>();
+  verify<double, 9, 3>();
+  verify<float, 12, 6>();
+  verify<double, 12, 6>();
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,92 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/kalman.hpp"
+#include "fcarouge/kalman_oosm.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+
+namespace fcarouge::test {
+namespace {
+template <auto Size> using vector = column_vector<double, Size>;
+template <auto Row, auto Column> using matrix = matrix<double, Row, Column>;
+
+//! @test Verifies the estimates with late measurements are the estimates of
+//! the in-sequence measurements, and that measurements older than the history
+//! are discarded.
+[[maybe_unused]] const auto test{[] {
+  const matrix<2, 2> f{{1., 0.1}, {0., 1.}};
+  const matrix<1, 2> h{{1., 0.}};
+  kalman filter{state{vector<2>{1., 2.}},
+                output<vector<1>>,
+                estimate_uncertainty{{10., 1.}, {1., 5.}},
+                process_uncertainty{{0.1, 0.}, {0., 0.1}},
+                output_uncertainty{4.},
+                output_model{h},
+                state_transition{f}};
+
+  auto in_sequence{filter};
+  oosm out_of_sequence{filter, horizon<8>};
+
+  for (int i{0}; i < 20; ++i) {
+    const double time{0.1 * i};
+    in_sequence.predict();
+    out_of_sequence.predict(time);
+    in_sequence.update(0.3 * i);
+    if (i % 4 != 1) {
+      out_of_sequence.update(time, 0.3 * i);
+    }
+    if (i % 4 == 3) {
+      [[maybe_unused]] const bool applied{
+          out_of_sequence.update(time - 0.2, 0.3 * (i - 2))};
+      assert(applied);
+    }
+  }
+
+  assert(out_of_sequence.size() == 8);
+  assert(out_of_sequence.x().isApprox(in_sequence.x()));
+  assert(out_of_sequence.p().isApprox(in_sequence.p()));
+
+  [[maybe_unused]] const bool discarded{!out_of_sequence.update(0., 0.)};
+  assert(discarded);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
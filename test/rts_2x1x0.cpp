@@ -0,0 +1,122 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/kalman.hpp"
+#include "fcarouge/kalman_mapped_history.hpp"
+#include "fcarouge/kalman_smoother.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <filesystem>
+
+namespace fcarouge::test {
+namespace {
+template <auto Size> using vector = column_vector<double, Size>;
+template <auto Row, auto Column> using matrix = matrix<double, Row, Column>;
+
+//! @test Verifies the smoothed estimates of the last step are the filtered
+//! estimates, that smoothing reduces the uncertainty of the past estimates, and
+//! that the history storages produce the same estimates.
+[[maybe_unused]] const auto test{[] {
+  const matrix<2, 2> f{{1., 0.5}, {0., 1.}};
+  const matrix<1, 2> h{{1., 0.}};
+  kalman filter{state{vector<2>{1., 2.}},
+                output<vector<1>>,
+                estimate_uncertainty{{10., 1.}, {1., 5.}},
+                process_uncertainty{{0.1, 0.}, {0., 0.1}},
+                output_uncertainty{4.},
+                output_model{h},
+                state_transition{f}};
+
+  rts smoother{filter};
+  std::array<vector<2>, 21> filtered{};
+  std::array<vector<2>, 21> smoothed{};
+  std::array<double, 21> filtered_uncertainty{};
+  std::array<double, 21> smoothed_uncertainty{};
+
+  for (std::size_t i{0}; i < 20; ++i) {
+    filtered[i] = smoother.x();
+    filtered_uncertainty[i] = smoother.p().trace();
+    smoother.predict();
+    smoother.update(0.3 * static_cast<double>(i));
+  }
+  filtered[20] = smoother.x();
+  filtered_uncertainty[20] = smoother.p().trace();
+  assert(smoother.size() == 20);
+
+  smoother.smooth([&smoothed, &smoothed_uncertainty](
+                      std::size_t step, const vector<2> &x,
+                      const matrix<2, 2> &p) {
+    smoothed[step] = x;
+    smoothed_uncertainty[step] = p.trace();
+  });
+
+  for (std::size_t i{0}; i < 21; ++i) {
+    assert(smoothed_uncertainty[i] <= filtered_uncertainty[i] + 1e-12);
+  }
+  assert(smoothed[20] == filtered[20]);
+  assert(!smoothed[10].isApprox(filtered[10]));
+
+#if __has_include(<sys/mman.h>)
+  const std::filesystem::path path{std::filesystem::temp_directory_path() /
+                                   "rts_2x1x0.history"};
+  {
+    rts<decltype(filter), mapped_history> mapped{filter, path.string(), 4};
+
+    for (std::size_t i{0}; i < 20; ++i) {
+      mapped.predict();
+      mapped.update(0.3 * static_cast<double>(i));
+    }
+
+    std::array<vector<2>, 21> mapped_smoothed{};
+    mapped.smooth([&mapped_smoothed](std::size_t step, const vector<2> &x,
+                                     [[maybe_unused]] const matrix<2, 2> &p) {
+      mapped_smoothed[step] = x;
+    });
+
+    assert(mapped_smoothed == smoothed);
+  }
+  std::filesystem::remove(path);
+#endif
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
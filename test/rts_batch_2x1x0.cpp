@@ -0,0 +1,113 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+#include "fcarouge/kalman.hpp"
+#include "fcarouge/kalman_smoother.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+namespace fcarouge::test {
+namespace {
+template <auto Size> using vector = column_vector<double, Size>;
+template <auto Row, auto Column> using matrix = matrix<double, Row, Column>;
+
+//! @test Verifies the smoothed estimates and uncertainties of a two-step
+//! problem are the closed-form batch least-squares solution over the stacked
+//! states: the information matrix `J` of the prior, the transitions, and the
+//! measurements gives the smoothed means `J⁻¹ * b` and uncertainties, the
+//! diagonal blocks of `J⁻¹`.
+[[maybe_unused]] const auto test{[] {
+  const vector<2> x0{1., 2.};
+  const matrix<2, 2> p0{{10., 1.}, {1., 5.}};
+  const matrix<2, 2> q{{0.1, 0.}, {0., 0.2}};
+  const matrix<2, 2> f{{1., 0.5}, {0., 1.}};
+  const matrix<1, 2> h{{1., 0.}};
+  const double r{4.};
+  const std::array<double, 2> z{2.5, 3.5};
+
+  kalman filter{state{x0},
+                output<vector<1>>,
+                estimate_uncertainty{p0},
+                process_uncertainty{q},
+                output_uncertainty{r},
+                output_model{h},
+                state_transition{f}};
+  rts smoother{filter};
+
+  for (const double measured : z) {
+    smoother.predict();
+    smoother.update(measured);
+  }
+
+  const matrix<2, 2> p0_inverse{p0.inverse()};
+  const matrix<2, 2> q_inverse{q.inverse()};
+  const matrix<2, 2> measured{h.transpose() * h / r};
+  matrix<6, 6> j{matrix<6, 6>::Zero()};
+  vector<6> b{vector<6>::Zero()};
+  j.block<2, 2>(0, 0) += p0_inverse;
+  b.segment<2>(0) += p0_inverse * x0;
+  for (std::size_t k{1}; k <= 2; ++k) {
+    const auto previous{static_cast<Eigen::Index>(2 * (k - 1))};
+    const auto current{static_cast<Eigen::Index>(2 * k)};
+    j.block<2, 2>(previous, previous) += f.transpose() * q_inverse * f;
+    j.block<2, 2>(previous, current) -= f.transpose() * q_inverse;
+    j.block<2, 2>(current, previous) -= q_inverse * f;
+    j.block<2, 2>(current, current) += q_inverse + measured;
+    b.segment<2>(current) += h.transpose() * z[k - 1] / r;
+  }
+  const matrix<6, 6> covariance{j.inverse()};
+  const vector<6> mean{covariance * b};
+
+  std::size_t calls{0};
+  smoother.smooth([&](std::size_t step, const vector<2> &x,
+                      const matrix<2, 2> &p) {
+    const auto index{static_cast<Eigen::Index>(2 * step)};
+    assert((x - mean.segment<2>(index)).norm() < 1e-9 &&
+           "The smoothed state is the batch solution.");
+    assert((p - covariance.block<2, 2>(index, index)).norm() < 1e-9 &&
+           "The smoothed uncertainty is the batch solution.");
+    ++calls;
+  });
+  assert(calls == 3);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
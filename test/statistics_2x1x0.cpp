@@ -0,0 +1,121 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/kalman.hpp"
+#include "fcarouge/kalman_statistics.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+
+namespace fcarouge::test {
+namespace {
+template <auto Size> using vector = column_vector<double, Size>;
+template <auto Row, auto Column> using matrix = matrix<double, Row, Column>;
+
+//! @test Verifies the running statistics decorator computes the normalized
+//! innovation squared, the log-likelihood, and the sliding window mean and
+//! variance of the innovations of the updates. The statistics of the empty
+//! window are zero and an outlier leaving the window does not leave a rounding
+//! residue in the variance.
+[[maybe_unused]] const auto test{[] {
+  auto filter{kalman{state{vector<2>{0., 1.}},
+                     output<vector<1>>,
+                     estimate_uncertainty{{10., 0.}, {0., 10.}},
+                     process_uncertainty{{0.1, 0.}, {0., 0.1}},
+                     output_uncertainty{4.},
+                     output_model{matrix<1, 2>{{1., 0.}}},
+                     state_transition{matrix<2, 2>{{1., 1.}, {0., 1.}}}} |
+              statistics<4>};
+
+  assert(filter.size() == 0 && filter.mean()(0) == 0. &&
+         filter.variance()(0) == 0.);
+
+  const double measured[]{1.3, 1.8, 3.4, 3.9, 5.6, 5.7, 7.4, 7.8, 9.5, 9.9};
+  double innovations[10]{};
+
+  for (std::size_t step{0}; step < 10; ++step) {
+    filter.predict();
+    filter.update(measured[step]);
+    innovations[step] = filter.y()(0);
+
+    [[maybe_unused]] const double s{filter.s()(0)};
+    [[maybe_unused]] const double nis{innovations[step] *
+                                      innovations[step] / s};
+    assert(std::abs(filter.nis() - nis) < 1e-9);
+    assert(std::abs(filter.log_likelihood() +
+                    (nis + std::log(2. * std::numbers::pi * s)) / 2.) <
+           1e-9);
+
+    const std::size_t size{step < 4 ? step + 1 : 4};
+    assert(filter.size() == size);
+    double mean{0.};
+    for (std::size_t index{step + 1 - size}; index <= step; ++index) {
+      mean += innovations[index] / static_cast<double>(size);
+    }
+    [[maybe_unused]] double variance{0.};
+    for (std::size_t index{step + 1 - size}; index <= step; ++index) {
+      variance += (innovations[index] - mean) * (innovations[index] - mean) /
+                  static_cast<double>(size);
+    }
+    assert(std::abs(filter.mean()(0) - mean) < 1e-9);
+    assert(std::abs(filter.variance()(0) - variance) < 1e-9);
+  }
+
+  auto steady{kalman{state{vector<2>{0., 0.}},
+                     output<vector<1>>,
+                     estimate_uncertainty{{1e-12, 0.}, {0., 1e-12}},
+                     process_uncertainty{{0., 0.}, {0., 0.}},
+                     output_uncertainty{1.},
+                     output_model{matrix<1, 2>{{1., 0.}}},
+                     state_transition{matrix<2, 2>{{1., 0.}, {0., 1.}}}} |
+              statistics<4>};
+
+  steady.update(1e8);
+  for (std::size_t step{0}; step < 7; ++step) {
+    steady.update(0.1 * static_cast<double>(step));
+  }
+  assert(std::abs(steady.variance()(0) - 0.0125) < 1e-9 &&
+         "The outlier left no residue in the window variance.");
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
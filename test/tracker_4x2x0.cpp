@@ -0,0 +1,121 @@
+/*  __          _      __  __          _   _
+| |/ /    /\   | |    |  \/  |   /\   | \ | |
+| ' /    /  \  | |    | \  / |  /  \  |  \| |
+|  <    / /\ \ | |    | |\/| | / /\ \ | . ` |
+| . \  / ____ \| |____| |  | |/ ____ \| |\  |
+|_|\_\/_/    \_\______|_|  |_/_/    \_\_| \_|
+
+Kalman Filter
+Version 0.5.4
+https://github.com/FrancoisCarouge/Kalman
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/kalman.hpp"
+#include "fcarouge/kalman_tracker.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+
+namespace fcarouge::test {
+namespace {
+template <auto Size> using vector = column_vector<double, Size>;
+template <auto Row, auto Column> using matrix = matrix<double, Row, Column>;
+
+//! @test Verifies the tracks of crossing and occluded objects keep their
+//! identifiers through the assignments, and die and are born again after an
+//! occlusion.
+[[maybe_unused]] const auto test{[] {
+  const kalman prototype{
+      state{vector<4>{0., 0., 0., 0.}},
+      output<vector<2>>,
+      estimate_uncertainty{{1., 0., 0., 0.},
+                           {0., 1., 0., 0.},
+                           {0., 0., 4., 0.},
+                           {0., 0., 0., 4.}},
+      process_uncertainty{{0.01, 0., 0., 0.},
+                          {0., 0.01, 0., 0.},
+                          {0., 0., 0.01, 0.},
+                          {0., 0., 0., 0.01}},
+      output_uncertainty{{0.25, 0.}, {0., 0.25}},
+      output_model{matrix<2, 4>{{1., 0., 0., 0.}, {0., 1., 0., 0.}}},
+      state_transition{matrix<4, 4>{{1., 0., 1., 0.},
+                                    {0., 1., 0., 1.},
+                                    {0., 0., 1., 0.},
+                                    {0., 0., 0., 1.}}}};
+
+  tracker objects{prototype,
+                  [](auto &filter, const vector<2> &z) {
+                    filter.x(z(0), z(1), 0., 0.);
+                  },
+                  8};
+
+  // Two objects crossing, and an object occluded from the tenth to the
+  // twentieth frames.
+  const auto position{[](std::size_t object, double frame) {
+    switch (object) {
+    case 0:
+      return vector<2>{frame, 0.5 * frame};
+    case 1:
+      return vector<2>{10. - frame, 0.5 * frame};
+    default:
+      return vector<2>{0., 50. - frame};
+    }
+  }};
+
+  std::size_t identifiers[3]{};
+  std::size_t identified[3]{};
+  for (std::size_t frame{0}; frame < 30; ++frame) {
+    const bool occluded{frame >= 10 && frame < 20};
+    const vector<2> detections[]{position(2, static_cast<double>(frame)),
+                                 position(1, static_cast<double>(frame)),
+                                 position(0, static_cast<double>(frame))};
+    const std::size_t count{occluded ? std::size_t{2} : std::size_t{3}};
+    objects.predict();
+    objects.update(std::span{detections + 3 - count, count});
+    for (std::size_t object{0}; object < count; ++object) {
+      const std::size_t identifier{objects.assignments()[count - 1 - object]};
+      if (frame == 0 || (object == 2 && frame == 20)) {
+        identifiers[object] = identifier;
+      }
+      identified[object] += identifier == identifiers[object];
+    }
+  }
+
+  assert(identified[0] == 30 && identified[1] == 30 &&
+         "The crossing objects keep their identifiers.");
+  assert(identified[2] == 20);
+  assert(identifiers[2] == 3 && "The occluded object is born again.");
+  assert(objects.tracks().size() == 3);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test